@@ -0,0 +1,429 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Oleksandr Koval
+
+/**
+ * @file broadcast_log.hpp
+ * @brief Contains multi-producer log of messages with independent
+ * subscribers, not included by `sbepp.hpp`
+ */
+
+#pragma once
+
+#include <sbepp/sbepp.hpp>
+#include <sbepp/ring.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+
+SBEPP_WARNINGS_OFF();
+
+namespace sbepp
+{
+namespace detail
+{
+// precedes each log record, its first 8 bytes are accessed atomically and
+// hold record position plus one when record is committed
+struct log_record_header
+{
+    std::uint64_t committed_position;
+    std::uint32_t size;
+    std::uint32_t record_size;
+};
+
+constexpr std::size_t log_record_alignment() noexcept
+{
+    return sizeof(log_record_header);
+}
+
+constexpr std::size_t log_align(const std::size_t size) noexcept
+{
+    return (size + log_record_alignment() - 1)
+           & ~(log_record_alignment() - 1);
+}
+
+constexpr std::uint32_t log_padding_size() noexcept
+{
+    return std::numeric_limits<std::uint32_t>::max();
+}
+} // namespace detail
+
+template<typename SchemaTag>
+class broadcast_log;
+
+//! @brief Region of `sbepp::broadcast_log` claimed by producer
+class log_claim
+{
+public:
+    //! @brief Constructs empty claim
+    log_claim() = default;
+
+    //! @brief Returns pointer to the claimed region
+    std::uint8_t* data() const noexcept
+    {
+        return ptr;
+    }
+
+    //! @brief Returns size of the claimed region
+    std::size_t size() const noexcept
+    {
+        return claim_size;
+    }
+
+    //! @brief Checks if claim is empty
+    SBEPP_CPP17_NODISCARD bool empty() const noexcept
+    {
+        return !ptr;
+    }
+
+private:
+    template<typename SchemaTag>
+    friend class broadcast_log;
+
+    std::uint8_t* ptr{};
+    std::size_t claim_size{};
+    std::uint64_t position{};
+
+    log_claim(
+        std::uint8_t* ptr,
+        const std::size_t size,
+        const std::uint64_t position) noexcept
+        : ptr{ptr}, claim_size{size}, position{position}
+    {
+    }
+};
+
+/**
+ * @brief Constructs view from a log claim
+ *
+ * @tparam View view template
+ * @param claim non-empty claim
+ * @return view to the whole claimed region
+ */
+template<template<typename> class View>
+View<std::uint8_t> make_view(const log_claim& claim) noexcept
+{
+    SBEPP_ASSERT(!claim.empty());
+    return {claim.data(), claim.size()};
+}
+
+/**
+ * @brief Multi-producer log of schema messages read by any number of
+ *  independent subscribers
+ *
+ * Producers reserve space using atomic fetch-add on the shared tail, encode
+ * message in place and commit it. Records are ordered by reservation. Each
+ * subscriber tracks its own position and reads messages in place as
+ * `sbepp::stream_message` whose `templateId` is taken from the schema
+ * message header. The log is a circular buffer which never blocks producers,
+ * a subscriber which falls behind by more than `capacity()` bytes is lapped,
+ * it skips to the current tail and increments its `lapped_count()`.
+ *
+ * Example:
+ * ```cpp
+ * sbepp::broadcast_log<market::schema> log{1 << 20};
+ *
+ * // any producer thread
+ * auto claim = log.claim(size);
+ * auto m = sbepp::make_view<market::messages::msg>(claim);
+ * // encode...
+ * log.commit(claim, sbepp::size_bytes(m));
+ *
+ * // each consumer thread
+ * auto subscriber = log.subscribe();
+ * subscriber.poll([](sbepp::stream_message<const std::uint8_t> m) {
+ *     sbepp::dispatch<market::schema>(m.data(), m.size(), visitor);
+ * });
+ * ```
+ *
+ * @tparam SchemaTag schema tag
+ * @note handler can observe partially overwritten message if subscriber is
+ *  lapped while the message is being handled. Such message is still passed
+ *  to the handler but `lapped_count()` is incremented right after it. Record
+ *  header is validated before the handler is called so message size never
+ *  exceeds its record.
+ */
+template<typename SchemaTag>
+class broadcast_log
+{
+public:
+    //! @brief Message type passed to subscribers
+    using message_type = stream_message<const std::uint8_t>;
+
+    //! @brief Independent reader of `sbepp::broadcast_log`
+    class subscriber
+    {
+    public:
+        /**
+         * @brief Handles available messages in order
+         *
+         * @param handler callable with `(message_type)` signature
+         * @param limit max number of messages to handle
+         * @return number of handled messages
+         */
+        template<typename Handler>
+        std::size_t poll(
+            Handler&& handler,
+            const std::size_t limit =
+                std::numeric_limits<std::size_t>::max())
+        {
+            std::size_t count{};
+            while(count != limit)
+            {
+                const auto ptr = log->buffer() + log->offset(position);
+                if(log->load_committed_position(ptr) != position + 1)
+                {
+                    if(is_lapped())
+                    {
+                        skip_to_tail();
+                        continue;
+                    }
+                    break;
+                }
+
+                detail::log_record_header header;
+                std::memcpy(&header, ptr, sizeof(header));
+                // producer which has lapped the subscriber could overwrite
+                // the header after its commit was checked, header is
+                // validated to never act on a torn one
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if(is_lapped() || !is_valid(header))
+                {
+                    skip_to_tail();
+                    continue;
+                }
+
+                if(header.size != detail::log_padding_size())
+                {
+                    const auto data = ptr + sizeof(header);
+                    handler(message_type{
+                        data, header.size, template_id(data, header.size)});
+                    count++;
+                }
+
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if(is_lapped())
+                {
+                    skip_to_tail();
+                    continue;
+                }
+                position += header.record_size;
+            }
+            return count;
+        }
+
+        //! @brief Returns subscriber position in the log
+        std::uint64_t get_position() const noexcept
+        {
+            return position;
+        }
+
+        //! @brief Returns how many times subscriber was lapped
+        std::size_t lapped_count() const noexcept
+        {
+            return lapped;
+        }
+
+    private:
+        friend class broadcast_log;
+
+        const broadcast_log* log;
+        std::uint64_t position;
+        std::size_t lapped{};
+
+        subscriber(
+            const broadcast_log& log, const std::uint64_t position) noexcept
+            : log{&log}, position{position}
+        {
+        }
+
+        bool is_lapped() const noexcept
+        {
+            return log->tail.value.load(std::memory_order_acquire) - position
+                   > log->capacity();
+        }
+
+        void skip_to_tail() noexcept
+        {
+            position = log->tail.value.load(std::memory_order_acquire);
+            lapped++;
+        }
+
+        bool is_valid(const detail::log_record_header& header) const noexcept
+        {
+            return (header.record_size >= sizeof(header))
+                   && (header.record_size <= log->capacity())
+                   && (header.record_size % detail::log_record_alignment()
+                       == 0)
+                   && ((header.size == detail::log_padding_size())
+                       || (header.size
+                           <= header.record_size - sizeof(header)));
+        }
+
+        static message_id_t
+            template_id(const std::uint8_t* data, const std::size_t size)
+        {
+            using traits = schema_traits<SchemaTag>;
+            using header_tag = typename traits::header_type_tag;
+            if(size < composite_traits<header_tag>::size_bytes())
+            {
+                return {};
+            }
+            return *sbepp::make_view<traits::template header_type>(data, size)
+                        .templateId();
+        }
+    };
+
+    /**
+     * @brief Constructs log with the given buffer capacity
+     *
+     * @param capacity buffer size in bytes
+     * @pre `capacity` is a power of two
+     * @pre `capacity >= 128`
+     */
+    explicit broadcast_log(const std::size_t capacity)
+        : buffer_capacity{capacity},
+          storage{new std::uint64_t[capacity / sizeof(std::uint64_t)]()}
+    {
+        SBEPP_ASSERT(detail::is_power_of_two(capacity));
+        SBEPP_ASSERT(capacity >= 128);
+    }
+
+    broadcast_log(const broadcast_log&) = delete;
+    broadcast_log& operator=(const broadcast_log&) = delete;
+
+    //! @brief Returns buffer capacity in bytes
+    std::size_t capacity() const noexcept
+    {
+        return buffer_capacity;
+    }
+
+    //! @brief Returns max size of a single message
+    std::size_t max_size() const noexcept
+    {
+        return buffer_capacity / 2 - sizeof(detail::log_record_header);
+    }
+
+    /**
+     * @brief Reserves `size` bytes for the next message
+     *
+     * Can be called concurrently from multiple threads. Each claim should be
+     * committed, subscribers can't read past uncommitted record.
+     *
+     * @param size number of bytes to claim
+     * @return claimed region
+     * @pre `size <= max_size()`
+     */
+    log_claim claim(const std::size_t size) noexcept
+    {
+        SBEPP_ASSERT(size <= max_size());
+        const auto record_size =
+            detail::log_align(sizeof(detail::log_record_header) + size);
+        while(true)
+        {
+            const auto position =
+                tail.value.fetch_add(record_size, std::memory_order_acq_rel);
+            const auto contiguous = buffer_capacity - offset(position);
+            if(contiguous >= record_size)
+            {
+                return {
+                    buffer() + offset(position)
+                        + sizeof(detail::log_record_header),
+                    size,
+                    position};
+            }
+
+            // reservation crosses the buffer end, pad both parts and retry
+            commit_record(
+                position, detail::log_padding_size(), contiguous);
+            commit_record(
+                position + contiguous,
+                detail::log_padding_size(),
+                record_size - contiguous);
+        }
+    }
+
+    /**
+     * @brief Publishes claimed message to subscribers
+     *
+     * @param claim non-empty claim
+     * @param size actual message size
+     * @pre `size <= claim.size()`
+     */
+    void commit(const log_claim& claim, const std::size_t size) noexcept
+    {
+        SBEPP_ASSERT(!claim.empty());
+        SBEPP_ASSERT(size <= claim.size());
+        commit_record(
+            claim.position,
+            static_cast<std::uint32_t>(size),
+            detail::log_align(
+                sizeof(detail::log_record_header) + claim.size()));
+    }
+
+    //! @brief Creates subscriber which will see messages claimed after this
+    //!     call
+    subscriber subscribe() const noexcept
+    {
+        return subscriber{*this, tail.value.load(std::memory_order_acquire)};
+    }
+
+private:
+    struct alignas(detail::cache_line_size()) padded_position
+    {
+        std::atomic<std::uint64_t> value{};
+    };
+
+    std::size_t buffer_capacity;
+    std::unique_ptr<std::uint64_t[]> storage;
+    padded_position tail;
+
+    std::uint8_t* buffer() const noexcept
+    {
+        return reinterpret_cast<std::uint8_t*>(storage.get());
+    }
+
+    std::size_t offset(const std::uint64_t position) const noexcept
+    {
+        return static_cast<std::size_t>(position & (buffer_capacity - 1));
+    }
+
+    // the first header member is shared between producers and subscribers
+    static std::atomic<std::uint64_t>&
+        committed_position(std::uint8_t* header) noexcept
+    {
+        static_assert(
+            sizeof(std::atomic<std::uint64_t>) == sizeof(std::uint64_t),
+            "std::atomic<std::uint64_t> should have no overhead");
+        return *reinterpret_cast<std::atomic<std::uint64_t>*>(header);
+    }
+
+    static std::uint64_t
+        load_committed_position(std::uint8_t* header) noexcept
+    {
+        return committed_position(header).load(std::memory_order_acquire);
+    }
+
+    void commit_record(
+        const std::uint64_t position,
+        const std::uint32_t size,
+        const std::size_t record_size) noexcept
+    {
+        const auto ptr = buffer() + offset(position);
+        const auto record_size32 = static_cast<std::uint32_t>(record_size);
+        std::memcpy(
+            ptr + sizeof(std::uint64_t), &size, sizeof(std::uint32_t));
+        std::memcpy(
+            ptr + sizeof(std::uint64_t) + sizeof(std::uint32_t),
+            &record_size32,
+            sizeof(std::uint32_t));
+        committed_position(ptr).store(
+            position + 1, std::memory_order_release);
+    }
+};
+} // namespace sbepp
+
+SBEPP_WARNINGS_ON();
@@ -0,0 +1,471 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Oleksandr Koval
+
+/**
+ * @file buffer_pool.hpp
+ * @brief Contains thread-local pool of message buffers, not included by
+ * `sbepp.hpp`
+ */
+
+#pragma once
+
+#include <sbepp/sbepp.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+SBEPP_WARNINGS_OFF();
+
+namespace sbepp
+{
+class buffer_pool;
+
+namespace detail
+{
+class pool_state;
+
+// precedes each pooled block
+struct alignas(std::max_align_t) pool_block_header
+{
+    pool_block_header* next;
+    pool_state* owner;
+    std::size_t size_class;
+};
+
+// identifies the current thread, unlike addresses of thread-local objects,
+// IDs are not reused after thread exit
+inline std::uint64_t current_thread_id() noexcept
+{
+    static std::atomic<std::uint64_t> last_id{};
+    static thread_local const std::uint64_t id =
+        last_id.fetch_add(1, std::memory_order_relaxed) + 1;
+    return id;
+}
+
+constexpr std::size_t pool_min_block_size() noexcept
+{
+    return 64;
+}
+
+constexpr std::size_t pool_size_class_count() noexcept
+{
+    return 16;
+}
+
+constexpr std::size_t pool_class_size(const std::size_t size_class) noexcept
+{
+    return pool_min_block_size() << size_class;
+}
+
+inline void* default_pool_allocate(const std::size_t size)
+{
+    return ::operator new(size);
+}
+
+inline void default_pool_deallocate(void* ptr, const std::size_t) noexcept
+{
+    ::operator delete(ptr);
+}
+} // namespace detail
+
+/**
+ * @brief Owning handle to a block obtained from `sbepp::buffer_pool`
+ *
+ * Returns the block to its pool on destruction. Can be destroyed on any
+ * thread.
+ */
+class pooled_buffer
+{
+public:
+    //! @brief Constructs empty handle
+    pooled_buffer() = default;
+
+    pooled_buffer(const pooled_buffer&) = delete;
+
+    //! @brief Takes ownership of `other`'s block
+    pooled_buffer(pooled_buffer&& other) noexcept
+        : block{other.block}, block_size{other.block_size}
+    {
+        other.block = nullptr;
+        other.block_size = 0;
+    }
+
+    pooled_buffer& operator=(const pooled_buffer&) = delete;
+
+    //! @brief Releases owned block and takes ownership of `other`'s block
+    pooled_buffer& operator=(pooled_buffer&& other) noexcept
+    {
+        if(this != &other)
+        {
+            reset();
+            block = other.block;
+            block_size = other.block_size;
+            other.block = nullptr;
+            other.block_size = 0;
+        }
+        return *this;
+    }
+
+    ~pooled_buffer()
+    {
+        reset();
+    }
+
+    //! @brief Returns pointer to the block or `nullptr` for empty handle
+    std::uint8_t* data() const noexcept
+    {
+        return block ? reinterpret_cast<std::uint8_t*>(block + 1) : nullptr;
+    }
+
+    //! @brief Returns usable block size, can be larger than requested
+    std::size_t size() const noexcept
+    {
+        return block_size;
+    }
+
+    //! @brief Checks if handle is empty
+    SBEPP_CPP17_NODISCARD bool empty() const noexcept
+    {
+        return !block;
+    }
+
+    //! @brief Returns the block to its pool
+    //! @post `empty() == true`
+    inline void reset() noexcept;
+
+private:
+    friend class buffer_pool;
+
+    detail::pool_block_header* block{};
+    std::size_t block_size{};
+
+    pooled_buffer(
+        detail::pool_block_header* block, const std::size_t size) noexcept
+        : block{block}, block_size{size}
+    {
+    }
+};
+
+//! @brief `sbepp::buffer_pool` statistics
+struct buffer_pool_stats
+{
+    //! Number of allocations served from the pool
+    std::size_t hits;
+    //! Number of allocations which required upstream allocation
+    std::size_t misses;
+};
+
+namespace detail
+{
+// state of `buffer_pool`, outlives it while there are outstanding blocks so
+// they can be released after the pool is destroyed, e.g. when the pool
+// returned by `buffer_pool::local()` is destroyed on its thread exit
+class pool_state
+{
+public:
+    using allocate_fn = void* (*)(std::size_t);
+    using deallocate_fn = void (*)(void*, std::size_t);
+
+    allocate_fn upstream_allocate;
+    deallocate_fn upstream_deallocate;
+    const std::uint64_t owner_thread{current_thread_id()};
+    // accessed only by the owner thread
+    std::array<pool_block_header*, pool_size_class_count()> free_lists{};
+    // blocks released by other threads
+    std::atomic<pool_block_header*> remote_list{};
+    // set when the pool is destroyed, blocks are returned to upstream then
+    std::atomic<bool> orphaned{};
+    buffer_pool_stats stats{};
+
+    pool_state(allocate_fn allocate, deallocate_fn deallocate) noexcept
+        : upstream_allocate{allocate}, upstream_deallocate{deallocate}
+    {
+    }
+
+    pool_state(const pool_state&) = delete;
+    pool_state& operator=(const pool_state&) = delete;
+
+    // each outstanding block holds a reference
+    void add_reference() noexcept
+    {
+        references.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // returns cached blocks to upstream and drops pool's reference
+    void orphan() noexcept
+    {
+        orphaned.store(true, std::memory_order_release);
+        collect_remote();
+        for(auto& list : free_lists)
+        {
+            free_list(list);
+            list = nullptr;
+        }
+        remove_reference();
+    }
+
+    void release(pool_block_header* block, const std::size_t size) noexcept
+    {
+        if((block->size_class == pool_size_class_count())
+           || orphaned.load(std::memory_order_acquire))
+        {
+            upstream_deallocate(block, sizeof(pool_block_header) + size);
+        }
+        else if(owner_thread == current_thread_id())
+        {
+            block->next = free_lists[block->size_class];
+            free_lists[block->size_class] = block;
+        }
+        else
+        {
+            block->next = remote_list.load(std::memory_order_relaxed);
+            while(!remote_list.compare_exchange_weak(
+                block->next,
+                block,
+                std::memory_order_release,
+                std::memory_order_relaxed))
+            {
+            }
+        }
+        remove_reference();
+    }
+
+    // moves blocks returned from other threads to local free lists
+    void collect_remote() noexcept
+    {
+        auto block = remote_list.exchange(nullptr, std::memory_order_acquire);
+        while(block)
+        {
+            auto next = block->next;
+            block->next = free_lists[block->size_class];
+            free_lists[block->size_class] = block;
+            block = next;
+        }
+    }
+
+private:
+    // the pool itself holds one reference
+    std::atomic<std::size_t> references{1};
+
+    ~pool_state() = default;
+
+    void free_list(pool_block_header* block) noexcept
+    {
+        while(block)
+        {
+            auto next = block->next;
+            upstream_deallocate(
+                block,
+                sizeof(pool_block_header) + pool_class_size(block->size_class));
+            block = next;
+        }
+    }
+
+    void remove_reference() noexcept
+    {
+        if(references.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            // blocks which were pushed by other threads after the pool had
+            // drained the list
+            free_list(remote_list.exchange(nullptr, std::memory_order_acquire));
+            delete this;
+        }
+    }
+};
+} // namespace detail
+
+/**
+ * @brief Pool of recycled message buffers
+ *
+ * Blocks are grouped into power-of-two size classes from `min_block_size()`
+ * to `max_block_size()`, larger requests go straight to upstream. The pool
+ * is owned by the thread which created it, `allocate()` and the destructor
+ * should be called only from that thread. Buffers can be released on any
+ * thread, buffers from other threads are returned to the owner through a
+ * lock-free list and are reused on its next cache miss. `local()` gives a
+ * separate pool for each thread.
+ *
+ * Memory is obtained from upstream functions which default to
+ * `::operator new`/`::operator delete`, they can be replaced, for example, to
+ * use huge pages.
+ *
+ * Example:
+ * ```cpp
+ * auto buf = sbepp::buffer_pool::local().allocate(
+ *     sbepp::message_traits<market::schema::messages::msg>::size_bytes(
+ *         entries.size(), data.size()));
+ * auto m = sbepp::make_view<market::messages::msg>(buf);
+ * // encode and pass `buf` to another thread
+ * ```
+ *
+ * @note Buffers can outlive their pool, in that case they are returned
+ *  directly to upstream. The pool's internal state is reference-counted for
+ *  that so each allocation and release costs an uncontended atomic operation.
+ */
+class buffer_pool
+{
+public:
+    //! @brief Upstream allocation function type
+    using allocate_fn = void* (*)(std::size_t);
+    //! @brief Upstream deallocation function type, takes allocated size
+    using deallocate_fn = void (*)(void*, std::size_t);
+
+    /**
+     * @brief Constructs pool with default upstream functions
+     *
+     * @throws std::bad_alloc if internal state can't be allocated
+     */
+    buffer_pool()
+        : buffer_pool{
+            &detail::default_pool_allocate, &detail::default_pool_deallocate}
+    {
+    }
+
+    /**
+     * @brief Constructs pool with the given upstream functions
+     *
+     * @throws std::bad_alloc if internal state can't be allocated
+     */
+    buffer_pool(allocate_fn allocate, deallocate_fn deallocate)
+        : state{new detail::pool_state{allocate, deallocate}}
+    {
+    }
+
+    buffer_pool(const buffer_pool&) = delete;
+    buffer_pool& operator=(const buffer_pool&) = delete;
+
+    //! @brief Frees all cached blocks, outstanding blocks are returned to
+    //!     upstream when released
+    ~buffer_pool()
+    {
+        SBEPP_ASSERT(state->owner_thread == detail::current_thread_id());
+        state->orphan();
+    }
+
+    //! @brief Returns the size of the smallest size class
+    static constexpr std::size_t min_block_size() noexcept
+    {
+        return detail::pool_min_block_size();
+    }
+
+    //! @brief Returns the number of size classes
+    static constexpr std::size_t size_class_count() noexcept
+    {
+        return detail::pool_size_class_count();
+    }
+
+    //! @brief Returns the size of the largest size class
+    static constexpr std::size_t max_block_size() noexcept
+    {
+        return min_block_size() << (size_class_count() - 1);
+    }
+
+    //! @brief Returns pool of the current thread
+    static buffer_pool& local() noexcept
+    {
+        static thread_local buffer_pool pool;
+        return pool;
+    }
+
+    /**
+     * @brief Allocates block of at least `size` bytes
+     *
+     * @param size required size
+     * @return block handle
+     * @throws whatever upstream allocation function throws
+     */
+    pooled_buffer allocate(const std::size_t size)
+    {
+        SBEPP_ASSERT(state->owner_thread == detail::current_thread_id());
+        const auto size_class = get_size_class(size);
+        if(size_class == size_class_count())
+        {
+            state->stats.misses++;
+            return {new_block(size, size_class), size};
+        }
+
+        auto& free_list = state->free_lists[size_class];
+        if(!free_list)
+        {
+            state->collect_remote();
+        }
+
+        const auto block_size = detail::pool_class_size(size_class);
+        auto block = free_list;
+        if(block)
+        {
+            free_list = block->next;
+            state->stats.hits++;
+            state->add_reference();
+            return {block, block_size};
+        }
+
+        state->stats.misses++;
+        return {new_block(block_size, size_class), block_size};
+    }
+
+    //! @brief Returns pool statistics
+    buffer_pool_stats statistics() const noexcept
+    {
+        return state->stats;
+    }
+
+private:
+    detail::pool_state* state;
+
+    // returns `size_class_count()` for too large sizes
+    static SBEPP_CPP14_CONSTEXPR std::size_t
+        get_size_class(const std::size_t size) noexcept
+    {
+        std::size_t size_class{};
+        while((size_class != size_class_count())
+              && (detail::pool_class_size(size_class) < size))
+        {
+            size_class++;
+        }
+        return size_class;
+    }
+
+    detail::pool_block_header*
+        new_block(const std::size_t size, const std::size_t size_class)
+    {
+        auto block =
+            static_cast<detail::pool_block_header*>(state->upstream_allocate(
+                sizeof(detail::pool_block_header) + size));
+        block->next = nullptr;
+        block->owner = state;
+        block->size_class = size_class;
+        state->add_reference();
+        return block;
+    }
+};
+
+inline void pooled_buffer::reset() noexcept
+{
+    if(block)
+    {
+        block->owner->release(block, block_size);
+        block = nullptr;
+        block_size = 0;
+    }
+}
+
+/**
+ * @brief Constructs view from a pooled buffer
+ *
+ * @tparam View view template
+ * @param buf non-empty pooled buffer
+ * @return view to the whole buffer
+ */
+template<template<typename> class View>
+View<std::uint8_t> make_view(const pooled_buffer& buf) noexcept
+{
+    SBEPP_ASSERT(!buf.empty());
+    return {buf.data(), buf.size()};
+}
+} // namespace sbepp
+
+SBEPP_WARNINGS_ON();
@@ -0,0 +1,386 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Oleksandr Koval
+
+/**
+ * @file ipc.hpp
+ * @brief Contains shared memory channel of schema messages, requires OS
+ * support for blocking waits so it's not included by `sbepp.hpp`
+ */
+
+#pragma once
+
+#include <sbepp/sbepp.hpp>
+#include <sbepp/ring.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+
+//! @brief `1` if Linux futex is available for blocking waits in
+//!     `sbepp::ipc_reader`, `0` otherwise
+#if !defined(SBEPP_HAS_FUTEX) && defined(__linux__)
+#    define SBEPP_HAS_FUTEX 1
+#endif
+#ifndef SBEPP_HAS_FUTEX
+#    define SBEPP_HAS_FUTEX 0
+#endif
+#if SBEPP_HAS_FUTEX
+#    include <linux/futex.h>
+#    include <sys/syscall.h>
+#    include <unistd.h>
+#endif
+
+SBEPP_WARNINGS_OFF();
+
+namespace sbepp
+{
+namespace detail
+{
+constexpr std::uint64_t ipc_magic() noexcept
+{
+    // "SBEPPIPC"
+    return 0x5342455050495043;
+}
+
+constexpr std::uint32_t ipc_layout_version() noexcept
+{
+    return 1;
+}
+
+// placed at the beginning of shared memory region, followed by ring buffer
+struct alignas(cache_line_size()) ipc_channel_header
+{
+    // stored last by writer when the rest of header is initialized
+    std::atomic<std::uint64_t> magic{};
+    std::uint32_t layout_version{};
+    schema_id_t schema_id{};
+    version_t schema_version{};
+    std::uint64_t capacity{};
+
+    alignas(cache_line_size()) std::atomic<std::uint64_t> write_index{};
+    std::atomic<std::uint32_t> notification{};
+
+    alignas(cache_line_size()) std::atomic<std::uint64_t> read_index{};
+    std::atomic<std::uint32_t> reader_waiting{};
+};
+
+inline ring_buffer_ref make_ipc_ring(ipc_channel_header* header) noexcept
+{
+    return {
+        reinterpret_cast<std::uint8_t*>(header + 1),
+        static_cast<std::size_t>(header->capacity),
+        &header->write_index,
+        &header->read_index};
+}
+
+inline void futex_wait(
+    std::atomic<std::uint32_t>& word, const std::uint32_t expected) noexcept
+{
+#if SBEPP_HAS_FUTEX
+    // not `FUTEX_WAIT_PRIVATE` because the word is shared between processes
+    ::syscall(
+        SYS_futex,
+        reinterpret_cast<std::uint32_t*>(&word),
+        FUTEX_WAIT,
+        expected,
+        nullptr,
+        nullptr,
+        0);
+#else
+    (void)word;
+    (void)expected;
+#endif
+}
+
+inline void futex_wake(std::atomic<std::uint32_t>& word) noexcept
+{
+#if SBEPP_HAS_FUTEX
+    ::syscall(
+        SYS_futex,
+        reinterpret_cast<std::uint32_t*>(&word),
+        FUTEX_WAKE,
+        1,
+        nullptr,
+        nullptr,
+        0);
+#else
+    (void)word;
+#endif
+}
+} // namespace detail
+
+/**
+ * @brief Returns size of shared memory region required by IPC channel
+ *
+ * @param capacity ring buffer capacity
+ */
+constexpr std::size_t ipc_region_size(const std::size_t capacity) noexcept
+{
+    return sizeof(detail::ipc_channel_header) + capacity;
+}
+
+//! @brief Result of `sbepp::ipc_reader::attach()`
+enum class ipc_attach_result
+{
+    //! reader is attached to the channel
+    attached,
+    //! writer has not created the channel yet
+    not_initialized,
+    //! channel layout is not supported or region is too small
+    incompatible_layout,
+    //! channel `schemaId` doesn't match `sbepp::schema_traits::id()`
+    wrong_schema_id,
+    //! channel schema version doesn't match `sbepp::schema_traits::version()`
+    wrong_schema_version
+};
+
+//! @brief Wait strategy of `sbepp::ipc_reader::wait()`
+enum class ipc_wait
+{
+    //! spin until data is available
+    busy_spin,
+    //! sleep on futex until writer notifies about new data, falls back to
+    //! `busy_spin` when `SBEPP_HAS_FUTEX == 0`
+    block
+};
+
+/**
+ * @brief Writer side of shared memory channel of schema messages
+ *
+ * Channel is a single-producer single-consumer ring, see `sbepp::spsc_ring`,
+ * placed into a memory region shared between processes, for example, created
+ * by `memfd_create` or `shm_open` and mapped by `mmap`. Writer initializes
+ * the region and records schema ID and version from `sbepp::schema_traits`,
+ * readers of a different schema or version refuse to attach.
+ *
+ * Example:
+ * ```cpp
+ * auto fd = shm_open("/market", O_CREAT | O_RDWR, 0600);
+ * const auto size = sbepp::ipc_region_size(1 << 20);
+ * ftruncate(fd, size);
+ * auto memory = mmap(
+ *     nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+ *
+ * sbepp::ipc_writer<market::schema> writer;
+ * writer.create(memory, 1 << 20);
+ * auto claim = writer.claim();
+ * auto m = sbepp::make_view<market::messages::msg>(claim);
+ * // encode...
+ * writer.commit(sbepp::size_bytes(m));
+ * ```
+ *
+ * @tparam SchemaTag schema tag
+ */
+template<typename SchemaTag>
+class ipc_writer
+{
+public:
+    //! @brief Constructs writer which is not associated with any channel
+    ipc_writer() = default;
+
+    /**
+     * @brief Initializes channel in `memory`
+     *
+     * @param memory shared memory region of at least
+     *  `sbepp::ipc_region_size(capacity)` bytes aligned to 64 bytes
+     * @param capacity ring buffer capacity
+     * @pre `capacity` is a power of two
+     * @pre `capacity >= 64`
+     */
+    void create(void* memory, const std::size_t capacity) noexcept
+    {
+        SBEPP_ASSERT(detail::is_power_of_two(capacity));
+        SBEPP_ASSERT(capacity >= 64);
+        header = ::new(memory) detail::ipc_channel_header{};
+        header->layout_version = detail::ipc_layout_version();
+        header->schema_id = schema_traits<SchemaTag>::id();
+        header->schema_version = schema_traits<SchemaTag>::version();
+        header->capacity = capacity;
+        producer = {};
+        header->magic.store(detail::ipc_magic(), std::memory_order_release);
+    }
+
+    //! @brief Returns max size of a single message
+    //! @pre channel is created
+    std::size_t max_size() const noexcept
+    {
+        SBEPP_ASSERT(header);
+        return detail::make_ipc_ring(header).max_size();
+    }
+
+    /**
+     * @brief Claims `size` bytes for the next message
+     *
+     * @param size number of bytes to claim
+     * @return claimed region or empty claim if there's not enough free space
+     * @pre channel is created
+     * @pre `size <= max_size()`
+     * @pre there's no pending claim
+     */
+    ring_claim claim(const std::size_t size) noexcept
+    {
+        SBEPP_ASSERT(header);
+        return producer.claim(detail::make_ipc_ring(header), size);
+    }
+
+    //! @brief Claims `max_size()` bytes
+    ring_claim claim() noexcept
+    {
+        return claim(max_size());
+    }
+
+    /**
+     * @brief Publishes message from the last claim and wakes up blocked
+     *  reader
+     *
+     * @param size actual message size
+     * @pre there's pending claim
+     * @pre `size` is not greater than the claimed size
+     */
+    void commit(const std::size_t size) noexcept
+    {
+        SBEPP_ASSERT(header);
+        producer.commit(detail::make_ipc_ring(header), size);
+        // pairs with the fence in `ipc_reader::wait()`
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if(header->reader_waiting.load(std::memory_order_relaxed))
+        {
+            header->notification.fetch_add(1, std::memory_order_release);
+            detail::futex_wake(header->notification);
+        }
+    }
+
+private:
+    detail::ipc_channel_header* header{};
+    detail::ring_producer producer;
+};
+
+/**
+ * @brief Reader side of shared memory channel of schema messages
+ *
+ * See `sbepp::ipc_writer` for details. Example:
+ * ```cpp
+ * sbepp::ipc_reader<market::schema> reader;
+ * if(reader.attach(memory, size) != sbepp::ipc_attach_result::attached)
+ * {
+ *     // retry later or report incompatible writer
+ * }
+ * while(true)
+ * {
+ *     reader.wait(sbepp::ipc_wait::block);
+ *     reader.poll([](const std::uint8_t* data, std::size_t size) {
+ *         sbepp::dispatch<market::schema>(data, size, visitor);
+ *     });
+ * }
+ * ```
+ *
+ * @tparam SchemaTag schema tag
+ */
+template<typename SchemaTag>
+class ipc_reader
+{
+public:
+    //! @brief Constructs reader which is not attached to any channel
+    ipc_reader() = default;
+
+    /**
+     * @brief Attaches to the channel created by `sbepp::ipc_writer`
+     *
+     * @param memory shared memory region
+     * @param size region size
+     * @return `sbepp::ipc_attach_result::attached` on success, error
+     *  otherwise. `sbepp::ipc_attach_result::incompatible_layout` is also
+     *  returned if channel capacity is not a power of two, is less than 64
+     *  or doesn't fit into `size`
+     */
+    ipc_attach_result attach(void* memory, const std::size_t size) noexcept
+    {
+        header = nullptr;
+        if(size < sizeof(detail::ipc_channel_header))
+        {
+            return ipc_attach_result::incompatible_layout;
+        }
+
+        const auto h = static_cast<detail::ipc_channel_header*>(memory);
+        if(h->magic.load(std::memory_order_acquire) != detail::ipc_magic())
+        {
+            return ipc_attach_result::not_initialized;
+        }
+        const auto capacity = h->capacity;
+        if((h->layout_version != detail::ipc_layout_version())
+           || !detail::is_power_of_two(capacity) || (capacity < 64)
+           || (capacity > size - sizeof(detail::ipc_channel_header)))
+        {
+            return ipc_attach_result::incompatible_layout;
+        }
+        if(h->schema_id != schema_traits<SchemaTag>::id())
+        {
+            return ipc_attach_result::wrong_schema_id;
+        }
+        if(h->schema_version != schema_traits<SchemaTag>::version())
+        {
+            return ipc_attach_result::wrong_schema_version;
+        }
+
+        header = h;
+        consumer = {};
+        return ipc_attach_result::attached;
+    }
+
+    /**
+     * @brief Reads available messages in place
+     *
+     * @param handler callable with `(const std::uint8_t* data,
+     *  std::size_t size)` signature
+     * @param limit max number of messages to handle
+     * @return number of handled messages
+     * @pre reader is attached
+     */
+    template<typename Handler>
+    std::size_t poll(
+        Handler&& handler,
+        const std::size_t limit = std::numeric_limits<std::size_t>::max())
+    {
+        SBEPP_ASSERT(header);
+        return consumer.poll(detail::make_ipc_ring(header), handler, limit);
+    }
+
+    /**
+     * @brief Waits until there's at least one message to read
+     *
+     * @param mode wait strategy
+     * @pre reader is attached
+     */
+    void wait(const ipc_wait mode) noexcept
+    {
+        SBEPP_ASSERT(header);
+        const auto ring = detail::make_ipc_ring(header);
+        while(consumer.empty(ring))
+        {
+            if(mode == ipc_wait::busy_spin)
+            {
+                continue;
+            }
+
+            const auto notification =
+                header->notification.load(std::memory_order_acquire);
+            header->reader_waiting.store(1, std::memory_order_relaxed);
+            // pairs with the fence in `ipc_writer::commit()`
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if(consumer.empty(ring))
+            {
+                detail::futex_wait(header->notification, notification);
+            }
+            header->reader_waiting.store(0, std::memory_order_relaxed);
+        }
+    }
+
+private:
+    detail::ipc_channel_header* header{};
+    detail::ring_consumer consumer;
+};
+} // namespace sbepp
+
+SBEPP_WARNINGS_ON();
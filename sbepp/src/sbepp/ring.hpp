@@ -0,0 +1,404 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Oleksandr Koval
+
+/**
+ * @file ring.hpp
+ * @brief Contains single-producer single-consumer ring of messages, not
+ * included by `sbepp.hpp`
+ */
+
+#pragma once
+
+#include <sbepp/sbepp.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+
+SBEPP_WARNINGS_OFF();
+
+namespace sbepp
+{
+namespace detail
+{
+constexpr std::size_t cache_line_size() noexcept
+{
+    return 64;
+}
+
+constexpr bool is_power_of_two(const std::size_t n) noexcept
+{
+    return n && !(n & (n - 1));
+}
+
+// precedes each ring record, `size` is the payload size
+struct ring_record_header
+{
+    std::uint32_t size;
+    std::uint32_t is_padding;
+};
+
+constexpr std::size_t ring_record_alignment() noexcept
+{
+    return sizeof(std::uint64_t);
+}
+
+constexpr std::size_t ring_align(const std::size_t size) noexcept
+{
+    return (size + ring_record_alignment() - 1)
+           & ~(ring_record_alignment() - 1);
+}
+
+inline ring_record_header
+    read_ring_record_header(const std::uint8_t* ptr) noexcept
+{
+    ring_record_header header;
+    std::memcpy(&header, ptr, sizeof(header));
+    return header;
+}
+
+inline void write_ring_record_header(
+    std::uint8_t* ptr,
+    const std::size_t size,
+    const bool is_padding) noexcept
+{
+    const ring_record_header header{
+        static_cast<std::uint32_t>(size), is_padding};
+    std::memcpy(ptr, &header, sizeof(header));
+}
+} // namespace detail
+
+//! @brief Region of `sbepp::spsc_ring` claimed by producer
+class ring_claim
+{
+public:
+    //! @brief Constructs empty claim
+    ring_claim() = default;
+
+    //! @brief Constructs claim from pointer and size
+    ring_claim(std::uint8_t* ptr, const std::size_t size) noexcept
+        : ptr{ptr}, claim_size{size}
+    {
+    }
+
+    //! @brief Returns pointer to the claimed region
+    std::uint8_t* data() const noexcept
+    {
+        return ptr;
+    }
+
+    //! @brief Returns size of the claimed region
+    std::size_t size() const noexcept
+    {
+        return claim_size;
+    }
+
+    //! @brief Checks if the claim failed because ring is full
+    SBEPP_CPP17_NODISCARD bool empty() const noexcept
+    {
+        return !ptr;
+    }
+
+private:
+    std::uint8_t* ptr{};
+    std::size_t claim_size{};
+};
+
+/**
+ * @brief Constructs view from a ring claim
+ *
+ * @tparam View view template
+ * @param claim non-empty claim
+ * @return view to the whole claimed region
+ */
+template<template<typename> class View>
+View<std::uint8_t> make_view(const ring_claim& claim) noexcept
+{
+    SBEPP_ASSERT(!claim.empty());
+    return {claim.data(), claim.size()};
+}
+
+namespace detail
+{
+// SPSC ring storage, indexes are shared between producer and consumer
+struct ring_buffer_ref
+{
+    std::uint8_t* data;
+    std::size_t capacity;
+    std::atomic<std::uint64_t>* write_index;
+    std::atomic<std::uint64_t>* read_index;
+
+    std::size_t offset(const std::uint64_t pos) const noexcept
+    {
+        return static_cast<std::size_t>(pos & (capacity - 1));
+    }
+
+    std::size_t max_size() const noexcept
+    {
+        return capacity / 2 - sizeof(ring_record_header);
+    }
+};
+
+// producer-local state of SPSC ring
+class ring_producer
+{
+public:
+    ring_claim
+        claim(const ring_buffer_ref ring, const std::size_t size) noexcept
+    {
+        SBEPP_ASSERT(size <= ring.max_size());
+        SBEPP_ASSERT(!has_claim);
+        const auto record_size =
+            ring_align(sizeof(ring_record_header) + size);
+        auto pos = ring.write_index->load(std::memory_order_relaxed);
+        const auto contiguous = ring.capacity - ring.offset(pos);
+        const auto padding = (contiguous < record_size) ? contiguous : 0;
+        const auto required = pos + padding + record_size;
+        if(required - cached_read_index > ring.capacity)
+        {
+            cached_read_index =
+                ring.read_index->load(std::memory_order_acquire);
+            if(required - cached_read_index > ring.capacity)
+            {
+                return {};
+            }
+        }
+
+        if(padding)
+        {
+            write_ring_record_header(
+                ring.data + ring.offset(pos),
+                padding - sizeof(ring_record_header),
+                true);
+            pos += padding;
+        }
+        claim_index = pos;
+        claim_size = size;
+        has_claim = true;
+        return {
+            ring.data + ring.offset(pos) + sizeof(ring_record_header), size};
+    }
+
+    void commit(const ring_buffer_ref ring, const std::size_t size) noexcept
+    {
+        SBEPP_ASSERT(has_claim);
+        SBEPP_ASSERT(size <= claim_size);
+        write_ring_record_header(
+            ring.data + ring.offset(claim_index), size, false);
+        has_claim = false;
+        ring.write_index->store(
+            claim_index + ring_align(sizeof(ring_record_header) + size),
+            std::memory_order_release);
+    }
+
+private:
+    std::uint64_t cached_read_index{};
+    std::uint64_t claim_index{};
+    std::size_t claim_size{};
+    bool has_claim{};
+};
+
+// consumer-local state of SPSC ring
+class ring_consumer
+{
+public:
+    template<typename Handler>
+    std::size_t poll(
+        const ring_buffer_ref ring,
+        Handler& handler,
+        const std::size_t limit)
+    {
+        auto pos = ring.read_index->load(std::memory_order_relaxed);
+        if(pos == cached_write_index)
+        {
+            cached_write_index =
+                ring.write_index->load(std::memory_order_acquire);
+        }
+
+        std::size_t count{};
+        while((pos != cached_write_index) && (count != limit))
+        {
+            const auto ptr = ring.data + ring.offset(pos);
+            const auto header = read_ring_record_header(ptr);
+            pos += ring_align(sizeof(ring_record_header) + header.size);
+            if(!header.is_padding)
+            {
+                handler(
+                    static_cast<const std::uint8_t*>(ptr)
+                        + sizeof(ring_record_header),
+                    static_cast<std::size_t>(header.size));
+                count++;
+            }
+        }
+        ring.read_index->store(pos, std::memory_order_release);
+        return count;
+    }
+
+    bool empty(const ring_buffer_ref ring) noexcept
+    {
+        if(ring.read_index->load(std::memory_order_relaxed)
+           != cached_write_index)
+        {
+            return false;
+        }
+        cached_write_index = ring.write_index->load(std::memory_order_acquire);
+        return ring.read_index->load(std::memory_order_relaxed)
+               == cached_write_index;
+    }
+
+private:
+    std::uint64_t cached_write_index{};
+};
+} // namespace detail
+
+/**
+ * @brief Lock-free single-producer single-consumer ring of messages
+ *
+ * Producer claims a region, encodes a message directly in the ring and
+ * commits its actual size. Consumer reads messages in place. Each record is
+ * preceded by 8-byte header and is 8-byte aligned, records never wrap, when
+ * there's not enough space at the end of the buffer, it's filled by a
+ * padding record and the message is placed at the beginning.
+ *
+ * Producer and consumer indexes are placed on separate cache lines, each side
+ * caches the other's index and reloads it only when the ring looks
+ * full/empty. Consumer publishes its index once per `poll()` batch.
+ *
+ * Example:
+ * ```cpp
+ * sbepp::spsc_ring ring{1 << 20};
+ *
+ * // producer
+ * auto claim = ring.claim();
+ * if(!claim.empty())
+ * {
+ *     auto m = sbepp::make_view<market::messages::msg>(claim);
+ *     // encode...
+ *     ring.commit(sbepp::size_bytes(m));
+ * }
+ *
+ * // consumer
+ * ring.poll([](const std::uint8_t* data, std::size_t size) {
+ *     auto m = sbepp::make_const_view<market::messages::msg>(data, size);
+ *     // decode...
+ * });
+ * ```
+ */
+class spsc_ring
+{
+public:
+    /**
+     * @brief Constructs ring with the given buffer capacity
+     *
+     * @param capacity buffer size in bytes
+     * @pre `capacity` is a power of two
+     * @pre `capacity >= 64`
+     */
+    explicit spsc_ring(const std::size_t capacity)
+        : buffer_capacity{capacity},
+          storage{new std::uint64_t[capacity / sizeof(std::uint64_t)]}
+    {
+        SBEPP_ASSERT(detail::is_power_of_two(capacity));
+        SBEPP_ASSERT(capacity >= 64);
+    }
+
+    spsc_ring(const spsc_ring&) = delete;
+    spsc_ring& operator=(const spsc_ring&) = delete;
+
+    //! @brief Returns buffer capacity in bytes
+    std::size_t capacity() const noexcept
+    {
+        return buffer_capacity;
+    }
+
+    //! @brief Returns max size of a single message
+    std::size_t max_size() const noexcept
+    {
+        return buffer_capacity / 2 - sizeof(detail::ring_record_header);
+    }
+
+    /**
+     * @brief Claims `size` bytes for the next message
+     *
+     * Should be called only from producer thread.
+     *
+     * @param size number of bytes to claim
+     * @return claimed region or empty claim if there's not enough free space
+     * @pre `size <= max_size()`
+     * @pre there's no pending claim
+     */
+    ring_claim claim(const std::size_t size) noexcept
+    {
+        return producer.state.claim(ring(), size);
+    }
+
+    //! @brief Claims `max_size()` bytes
+    ring_claim claim() noexcept
+    {
+        return claim(max_size());
+    }
+
+    /**
+     * @brief Publishes message from the last claim
+     *
+     * @param size actual message size
+     * @pre there's pending claim
+     * @pre `size` is not greater than the claimed size
+     */
+    void commit(const std::size_t size) noexcept
+    {
+        producer.state.commit(ring(), size);
+    }
+
+    /**
+     * @brief Reads available messages in place
+     *
+     * Should be called only from consumer thread. Records are released back
+     * to producer after all of them are handled.
+     *
+     * @param handler callable with `(const std::uint8_t* data,
+     *  std::size_t size)` signature
+     * @param limit max number of messages to handle
+     * @return number of handled messages
+     */
+    template<typename Handler>
+    std::size_t poll(
+        Handler&& handler,
+        const std::size_t limit = std::numeric_limits<std::size_t>::max())
+    {
+        return consumer.state.poll(ring(), handler, limit);
+    }
+
+private:
+    struct alignas(detail::cache_line_size()) producer_side
+    {
+        std::atomic<std::uint64_t> write_index{};
+        detail::ring_producer state;
+    };
+
+    struct alignas(detail::cache_line_size()) consumer_side
+    {
+        std::atomic<std::uint64_t> read_index{};
+        detail::ring_consumer state;
+    };
+
+    std::size_t buffer_capacity;
+    std::unique_ptr<std::uint64_t[]> storage;
+    producer_side producer;
+    consumer_side consumer;
+
+    detail::ring_buffer_ref ring() noexcept
+    {
+        return {
+            reinterpret_cast<std::uint8_t*>(storage.get()),
+            buffer_capacity,
+            &producer.write_index,
+            &consumer.read_index};
+    }
+};
+} // namespace sbepp
+
+SBEPP_WARNINGS_ON();
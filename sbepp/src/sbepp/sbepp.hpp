@@ -16,6 +16,7 @@
 #include <cstring>
 #include <iterator>
 #include <limits>
+#include <memory>
 #include <type_traits>
 #include <initializer_list>
 
@@ -199,6 +200,18 @@ SBEPP_WARNINGS_OFF();
 #    define SBEPP_HAS_RANGES 0
 #endif
 
+//! @brief `1` if compiler supports `std::string_view`, `0` otherwise
+#if !defined(SBEPP_HAS_STRING_VIEW) && defined(__has_include) \
+    && (SBEPP_CPLUSPLUS >= 201703L)
+#    if __has_include(<string_view>)
+#        define SBEPP_HAS_STRING_VIEW 1
+#        include <string_view>
+#    endif
+#endif
+#ifndef SBEPP_HAS_STRING_VIEW
+#    define SBEPP_HAS_STRING_VIEW 0
+#endif
+
 //! @brief `1` if compiler supports `std::is_constant_evaluated()`, `0`
 //!  otherwise
 #if !defined(SBEPP_HAS_IS_CONSTANT_EVALUATED)   \
@@ -601,6 +614,50 @@ SBEPP_CPP20_CONSTEXPR void set_primitive(Byte* ptr, T value)
 #endif
 }
 
+// converts `count` consecutive primitives, the non-native case is a plain
+// byteswap loop which compilers turn into vector shuffles
+template<endian E, typename T, typename Byte>
+void get_primitives(const Byte* ptr, const std::size_t count, T* out) noexcept
+{
+    if((E == endian::native) || (sizeof(T) == 1))
+    {
+        if(count)
+        {
+            std::memcpy(out, ptr, count * sizeof(T));
+        }
+    }
+    else
+    {
+        for(std::size_t i = 0; i != count; i++)
+        {
+            T value;
+            std::memcpy(&value, ptr + i * sizeof(T), sizeof(T));
+            out[i] = byteswap(value);
+        }
+    }
+}
+
+template<endian E, typename T, typename Byte>
+void set_primitives(
+    Byte* ptr, const T* values, const std::size_t count) noexcept
+{
+    if((E == endian::native) || (sizeof(T) == 1))
+    {
+        if(count)
+        {
+            std::memcpy(ptr, values, count * sizeof(T));
+        }
+    }
+    else
+    {
+        for(std::size_t i = 0; i != count; i++)
+        {
+            const auto value = byteswap(values[i]);
+            std::memcpy(ptr + i * sizeof(T), &value, sizeof(T));
+        }
+    }
+}
+
 struct fill_message_header_tag
 {
     explicit fill_message_header_tag() = default;
@@ -676,6 +733,11 @@ struct access_by_tag_tag
     explicit access_by_tag_tag() = default;
 };
 
+struct load_block_tag
+{
+    explicit load_block_tag() = default;
+};
+
 template<typename T, typename U, endian E, typename View>
 SBEPP_CPP20_CONSTEXPR T
     get_value(const View view, const std::size_t offset) noexcept
@@ -685,6 +747,15 @@ SBEPP_CPP20_CONSTEXPR T
     return T{get_primitive<U, E>(view(addressof_tag{}) + offset)};
 }
 
+// used by generated `load_block_tag` implementations which check the whole
+// block size only once
+template<typename T, typename U, endian E, typename View>
+SBEPP_CPP20_CONSTEXPR T
+    get_block_value(const View view, const std::size_t offset) noexcept
+{
+    return T{get_primitive<U, E>(view(addressof_tag{}) + offset)};
+}
+
 template<endian E, typename T, typename View>
 SBEPP_CPP20_CONSTEXPR void
     set_value(const View view, const std::size_t offset, const T value) noexcept
@@ -968,7 +1039,7 @@ public:
         ptr = view(detail::get_level_tag{})
               + view(detail::get_block_length_tag{});
         ResView g{ptr, view(detail::end_ptr_tag{})};
-        ptr += g(detail::get_header_tag{})(detail::size_bytes_tag{});
+        ptr += header_size(g);
 
         return g;
     }
@@ -991,8 +1062,7 @@ public:
         SBEPP_ASSERT(
             (getter()(detail::addressof_tag{}) == ptr) && "Wrong cursor value");
         ResView res{ptr, view(detail::end_ptr_tag{})};
-        auto header = res(detail::get_header_tag{});
-        ptr += header(detail::size_bytes_tag{});
+        ptr += header_size(res);
         return res;
     }
 
@@ -1012,6 +1082,15 @@ private:
     friend class cursor;
 
     Byte* ptr{};
+
+    // group header size is fixed, it's taken from the header type so the
+    // header itself isn't accessed until it's validated by the caller
+    template<typename Group>
+    static constexpr std::size_t header_size(const Group&) noexcept
+    {
+        return decltype(std::declval<Group>()(detail::get_header_tag{})){}(
+            detail::size_bytes_tag{});
+    }
 };
 
 namespace detail
@@ -2134,6 +2213,179 @@ private:
 #endif
 };
 
+// similar to `random_access_iterator` but entries are located using
+// precomputed offsets, used to randomly access nested group entries
+template<
+    typename Byte,
+    typename ValueType,
+    typename BlockLengthType,
+    typename DifferenceType,
+    typename IndexType>
+class offset_table_iterator
+{
+public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = ValueType;
+    using reference = value_type;
+    using difference_type = DifferenceType;
+    using pointer = arrow_proxy<value_type>;
+
+    offset_table_iterator() = default;
+
+    SBEPP_CPP14_CONSTEXPR offset_table_iterator(
+        Byte* base,
+        const std::size_t* offsets,
+        const BlockLengthType block_length,
+        const IndexType index,
+        Byte* end) noexcept
+        : base{base},
+          offsets{offsets},
+          block_length{block_length},
+          index{index}
+#if SBEPP_SIZE_CHECKS_ENABLED
+          ,
+          end{end}
+#endif
+    {
+        (void)end;
+    }
+
+    constexpr reference operator*() const noexcept
+    {
+#if SBEPP_SIZE_CHECKS_ENABLED
+        return {base + offsets[index], end, block_length};
+#else
+        return {base + offsets[index], nullptr, block_length};
+#endif
+    }
+
+    constexpr pointer operator->() const noexcept
+    {
+        return pointer{operator*()};
+    }
+
+    SBEPP_CPP14_CONSTEXPR offset_table_iterator& operator++() noexcept
+    {
+        index++;
+        return *this;
+    }
+
+    SBEPP_CPP14_CONSTEXPR offset_table_iterator operator++(int) noexcept
+    {
+        auto old = *this;
+        operator++();
+        return old;
+    }
+
+    SBEPP_CPP14_CONSTEXPR offset_table_iterator& operator--() noexcept
+    {
+        index--;
+        return *this;
+    }
+
+    SBEPP_CPP14_CONSTEXPR offset_table_iterator operator--(int) noexcept
+    {
+        auto old = *this;
+        operator--();
+        return old;
+    }
+
+    SBEPP_CPP14_CONSTEXPR offset_table_iterator&
+        operator+=(difference_type n) noexcept
+    {
+        index += n;
+        return *this;
+    }
+
+    SBEPP_CPP14_CONSTEXPR offset_table_iterator
+        operator+(difference_type n) const noexcept
+    {
+        auto tmp = *this;
+        return tmp += n;
+    }
+
+    friend constexpr offset_table_iterator
+        operator+(difference_type n, const offset_table_iterator& it) noexcept
+    {
+        return it + n;
+    }
+
+    SBEPP_CPP14_CONSTEXPR offset_table_iterator&
+        operator-=(difference_type n) noexcept
+    {
+        return *this += -n;
+    }
+
+    SBEPP_CPP14_CONSTEXPR offset_table_iterator
+        operator-(difference_type n) const noexcept
+    {
+        auto tmp = *this;
+        return tmp -= n;
+    }
+
+    constexpr difference_type
+        operator-(const offset_table_iterator& rhs) const noexcept
+    {
+        return index - rhs.index;
+    }
+
+    constexpr reference operator[](difference_type n) const noexcept
+    {
+        return *(*this + n);
+    }
+
+    friend constexpr bool operator==(
+        const offset_table_iterator& lhs,
+        const offset_table_iterator& rhs) noexcept
+    {
+        return lhs.index == rhs.index;
+    }
+
+    friend constexpr bool operator!=(
+        const offset_table_iterator& lhs,
+        const offset_table_iterator& rhs) noexcept
+    {
+        return lhs.index != rhs.index;
+    }
+
+    friend constexpr bool operator<(
+        const offset_table_iterator& lhs,
+        const offset_table_iterator& rhs) noexcept
+    {
+        return lhs.index < rhs.index;
+    }
+
+    friend constexpr bool operator<=(
+        const offset_table_iterator& lhs,
+        const offset_table_iterator& rhs) noexcept
+    {
+        return lhs.index <= rhs.index;
+    }
+
+    friend constexpr bool operator>(
+        const offset_table_iterator& lhs,
+        const offset_table_iterator& rhs) noexcept
+    {
+        return lhs.index > rhs.index;
+    }
+
+    friend constexpr bool operator>=(
+        const offset_table_iterator& lhs,
+        const offset_table_iterator& rhs) noexcept
+    {
+        return lhs.index >= rhs.index;
+    }
+
+private:
+    Byte* base{};
+    const std::size_t* offsets{};
+    BlockLengthType block_length{};
+    IndexType index{};
+#if SBEPP_SIZE_CHECKS_ENABLED
+    Byte* end{};
+#endif
+};
+
 template<
     typename ValueType,
     typename IndexType,
@@ -2285,6 +2537,18 @@ private:
     IndexType length{};
 };
 
+// returns size of a nested group entry with empty groups and data members
+template<typename Entry>
+constexpr std::size_t empty_entry_size(const std::size_t block_length) noexcept;
+
+// writes `count` empty nested group entries starting at `ptr`
+template<typename Entry, typename Byte, typename BlockLength>
+SBEPP_CPP20_CONSTEXPR void fill_empty_entries(
+    Byte* ptr,
+    Byte* end,
+    const std::size_t count,
+    const BlockLength block_length) noexcept;
+
 //! @brief Base class for a flat group
 template<typename Byte, typename Entry, typename Dimension>
 class flat_group_base : public byte_range<Byte>
@@ -2415,6 +2679,65 @@ public:
         resize(0);
     }
 
+    /**
+     * @brief Inserts `count` zero-initialized entries before `pos`
+     *
+     * All bytes in `[addressof(*pos); tail_end)`, i.e. the rest of the group
+     * and everything that follows it, are moved forward by
+     * `count * blockLength` bytes.
+     *
+     * @param pos iterator before which entries are inserted
+     * @param count number of entries to insert
+     * @param tail_end end of the data that follows the group, usually
+     *  `sbepp::addressof(msg) + sbepp::size_bytes(msg)`
+     * @return iterator to the first inserted entry
+     * @pre `size() + count <= max_size()`
+     */
+    template<typename T = void, typename = enable_if_writable_t<Byte, T>>
+    SBEPP_CPP20_CONSTEXPR iterator insert(
+        iterator pos, const size_type count, Byte* tail_end) const noexcept
+    {
+        SBEPP_ASSERT(count <= max_size() - size());
+        const auto index = pos - begin();
+        const auto block_length =
+            (*this)(get_header_tag{}).blockLength().value();
+        const auto shift = static_cast<std::size_t>(count) * block_length;
+        auto ptr = (*pos)(addressof_tag{});
+        SBEPP_ASSERT(ptr <= tail_end);
+        SBEPP_SIZE_CHECK(tail_end, (*this)(end_ptr_tag{}), 0, shift);
+        std::copy_backward(ptr, tail_end, tail_end + shift);
+        std::fill_n(ptr, shift, Byte{});
+        resize(static_cast<size_type>(size() + count));
+
+        return begin() + index;
+    }
+
+    /**
+     * @brief Erases entries in `[first; last)` range
+     *
+     * All bytes in `[addressof(*last); tail_end)` are moved backward to
+     * `addressof(*first)`.
+     *
+     * @param first iterator to the first entry to erase
+     * @param last iterator past the last entry to erase
+     * @param tail_end end of the data that follows the group, usually
+     *  `sbepp::addressof(msg) + sbepp::size_bytes(msg)`
+     * @return iterator to the entry that followed the last erased one
+     */
+    template<typename T = void, typename = enable_if_writable_t<Byte, T>>
+    SBEPP_CPP20_CONSTEXPR iterator
+        erase(iterator first, iterator last, Byte* tail_end) const noexcept
+    {
+        SBEPP_ASSERT(first >= begin() && first <= last && last <= end());
+        const auto index = first - begin();
+        auto last_ptr = (*last)(addressof_tag{});
+        SBEPP_ASSERT(last_ptr <= tail_end);
+        std::copy(last_ptr, tail_end, (*first)(addressof_tag{}));
+        resize(static_cast<size_type>(size() - (last - first)));
+
+        return begin() + index;
+    }
+
     //! @brief Type of a cursor range. Satisfies `std::ranges::input_range`
     template<typename Byte2>
     using cursor_range_t = detail::cursor_range<
@@ -2637,6 +2960,87 @@ public:
         resize(0);
     }
 
+    /**
+     * @brief Inserts `count` empty entries before `pos`
+     *
+     * New entries have zero-initialized fields, empty nested groups and
+     * empty data members. All bytes in `[addressof(*pos); tail_end)`, i.e. the
+     * rest of the group and everything that follows it, are moved forward by
+     * the size of the inserted entries.
+     *
+     * @param pos iterator before which entries are inserted
+     * @param count number of entries to insert
+     * @param tail_end end of the data that follows the group, usually
+     *  `sbepp::addressof(msg) + sbepp::size_bytes(msg)`
+     * @return iterator to the first inserted entry
+     * @pre `size() + count <= max_size()`
+     */
+    template<typename T = void, typename = enable_if_writable_t<Byte, T>>
+    SBEPP_CPP20_CONSTEXPR iterator insert(
+        iterator pos, const size_type count, Byte* tail_end) const noexcept
+    {
+        SBEPP_ASSERT(count <= max_size() - size());
+        // `end()` doesn't hold a pointer, reach `pos` from `begin()`
+        auto it = begin();
+        size_type index{};
+        for(; it != pos; ++it)
+        {
+            index++;
+        }
+        const auto block_length =
+            (*this)(get_header_tag{}).blockLength().value();
+        const auto shift = count * empty_entry_size<Entry>(block_length);
+        auto ptr = (*it)(addressof_tag{});
+        SBEPP_ASSERT(ptr <= tail_end);
+        SBEPP_SIZE_CHECK(tail_end, (*this)(end_ptr_tag{}), 0, shift);
+        std::copy_backward(ptr, tail_end, tail_end + shift);
+        fill_empty_entries<Entry>(
+            ptr, (*this)(end_ptr_tag{}), count, block_length);
+        resize(static_cast<size_type>(size() + count));
+
+        return iterator{ptr, index, block_length, (*this)(end_ptr_tag{})};
+    }
+
+    /**
+     * @brief Erases entries in `[first; last)` range
+     *
+     * All bytes in `[addressof(*last); tail_end)` are moved backward to
+     * `addressof(*first)`.
+     *
+     * @param first iterator to the first entry to erase
+     * @param last iterator past the last entry to erase
+     * @param tail_end end of the data that follows the group, usually
+     *  `sbepp::addressof(msg) + sbepp::size_bytes(msg)`
+     * @return iterator to the entry that followed the last erased one
+     */
+    template<typename T = void, typename = enable_if_writable_t<Byte, T>>
+    SBEPP_CPP20_CONSTEXPR iterator
+        erase(iterator first, iterator last, Byte* tail_end) const noexcept
+    {
+        auto it = begin();
+        size_type index{};
+        for(; it != first; ++it)
+        {
+            index++;
+        }
+        auto first_ptr = (*it)(addressof_tag{});
+        size_type count{};
+        for(; it != last; ++it)
+        {
+            count++;
+        }
+        auto last_ptr = (*it)(addressof_tag{});
+        SBEPP_ASSERT(last_ptr <= tail_end);
+        std::copy(last_ptr, tail_end, first_ptr);
+        resize(static_cast<size_type>(size() - count));
+
+        return iterator{
+            first_ptr,
+            index,
+            (*this)(get_header_tag{}).blockLength().value(),
+            (*this)(end_ptr_tag{})};
+    }
+
     //! @brief Type of a cursor range. Satisfies `std::ranges::input_range`
     template<typename Byte2>
     using cursor_range_t = detail::cursor_range<
@@ -2825,6 +3229,17 @@ constexpr std::size_t get_header_size(View) noexcept
 {
     return 0;
 }
+
+template<typename View>
+using header_t = decltype(sbepp::get_header(std::declval<View>()));
+
+// header size is fixed so it's taken from an empty header view, it's safe even
+// if the header itself doesn't fit into the buffer
+template<typename View>
+constexpr std::size_t unchecked_header_size(View) noexcept
+{
+    return sbepp::size_bytes(header_t<View>{});
+}
 } // namespace detail
 
 /**
@@ -2989,7 +3404,13 @@ inline SBEPP_CPP20_CONSTEXPR std::size_t string_length(const char* str) noexcept
 //! @tparam Value array element type from schema
 //! @tparam N array length
 //! @tparam Tag type tag
-template<typename Byte, typename Value, std::size_t N, typename Tag>
+//! @tparam E schema endianness, used only by `copy_to()` and `assign_from()`
+template<
+    typename Byte,
+    typename Value,
+    std::size_t N,
+    typename Tag,
+    endian E = endian::native>
 class static_array_ref : public detail::byte_range<Byte>
 {
 public:
@@ -3097,7 +3518,7 @@ public:
     }
 
     /**
-     * @brief Returns `static_array_ref<Byte, Byte, N, Tag>`.
+     * @brief Returns `static_array_ref<Byte, Byte, N, Tag, E>`.
      *
      * Useful in constexpr context to modify an array which has different `Byte`
      * and `Value` types. Example:
@@ -3107,10 +3528,10 @@ public:
      * a1.raw()[0] = std::byte{'a'};   // OK
      * ```
      */
-    constexpr static_array_ref<Byte, detail::remove_cv_t<Byte>, N, Tag>
+    constexpr static_array_ref<Byte, detail::remove_cv_t<Byte>, N, Tag, E>
         raw() const noexcept
     {
-        return static_array_ref<Byte, detail::remove_cv_t<Byte>, N, Tag>{
+        return static_array_ref<Byte, detail::remove_cv_t<Byte>, N, Tag, E>{
             (*this)(detail::addressof_tag{}), (*this)(detail::end_ptr_tag{})};
     }
 
@@ -3147,25 +3568,69 @@ public:
      */
     SBEPP_CPP20_CONSTEXPR std::size_t strlen_r() const noexcept
     {
-        const auto last_non_null = std::find_if(
-            rbegin(),
-            rend(),
-            [](const value_type value)
+        if(is_constant_evaluated() || (sizeof(value_type) != 1))
+        {
+            const auto last_non_null = std::find_if(
+                rbegin(),
+                rend(),
+                [](const value_type value)
+                {
+                    return value != '\0';
+                });
+            return size() - (last_non_null - rbegin());
+        }
+        else
+        {
+            // skip trailing padding a word at a time, then find the exact
+            // position within the last non-zero word
+            const auto first = data();
+            auto length = size();
+            while(length >= sizeof(std::uint64_t))
+            {
+                std::uint64_t word;
+                std::memcpy(
+                    &word, first + length - sizeof(word), sizeof(word));
+                if(word)
+                {
+                    break;
+                }
+                length -= sizeof(word);
+            }
+
+            while(length && (first[length - 1] == '\0'))
             {
-                return value != '\0';
-            });
-        return size() - (last_non_null - rbegin());
+                length--;
+            }
+
+            return length;
+        }
     }
 
+#if SBEPP_HAS_STRING_VIEW
     /**
-     * @brief Assigns null-terminated string
+     * @brief Returns stored string as `std::string_view`
      *
-     * @param str null-terminated string
-     * @param eos_mode determines how many null bytes to write after the
-     *  end-of-string when `strlen(str) < size()`
-     * @return iterator past the last written string character (without null
-     *  bytes)
-     * @pre `str != nullptr`
+     * String length is calculated using `strlen()`. Available only for `char`
+     * arrays.
+     */
+    template<
+        typename T = value_type,
+        typename = enable_if_t<std::is_same<T, char>::value>>
+    SBEPP_CPP20_CONSTEXPR std::string_view to_string_view() const noexcept
+    {
+        return {data(), strlen()};
+    }
+#endif
+
+    /**
+     * @brief Assigns null-terminated string
+     *
+     * @param str null-terminated string
+     * @param eos_mode determines how many null bytes to write after the
+     *  end-of-string when `strlen(str) < size()`
+     * @return iterator past the last written string character (without null
+     *  bytes)
+     * @pre `str != nullptr`
      * @pre `strlen(str) <= size()`
      */
     template<typename T = void, typename = enable_if_writable_t<Byte, T>>
@@ -3228,6 +3693,49 @@ public:
         return res;
     }
 
+    /**
+     * @brief Copies all elements to `out` converting them to native byte order
+     *
+     * @param out destination array
+     * @return pointer past the last written element
+     * @pre `out` can hold `size()` elements
+     */
+    value_type* copy_to(value_type* out) const noexcept
+    {
+        SBEPP_ASSERT(out != nullptr);
+        SBEPP_SIZE_CHECK(
+            (*this)(addressof_tag{}),
+            (*this)(end_ptr_tag{}),
+            0,
+            sizeof(value_type) * N);
+        get_primitives<E>((*this)(addressof_tag{}), size(), out);
+        return out + size();
+    }
+
+    /**
+     * @brief Assigns `count` native values converting them to schema byte
+     *  order
+     *
+     * @param values values to assign
+     * @param count number of values to assign
+     * @return iterator past the last written element
+     * @pre `count <= size()`
+     */
+    template<typename T = void, typename = enable_if_writable_t<Byte, T>>
+    iterator
+        assign_from(const value_type* values, size_type count) const noexcept
+    {
+        SBEPP_ASSERT(count <= size());
+        SBEPP_ASSERT((values != nullptr) || !count);
+        SBEPP_SIZE_CHECK(
+            (*this)(addressof_tag{}),
+            (*this)(end_ptr_tag{}),
+            0,
+            sizeof(value_type) * N);
+        set_primitives<E>((*this)(addressof_tag{}), values, count);
+        return begin() + count;
+    }
+
     /**
      * @brief Assigns value to all elements
      *
@@ -3632,6 +4140,48 @@ public:
         std::copy_n(str, length, begin());
     }
 
+    /**
+     * @brief Copies all elements to `out` converting them to native byte order
+     *
+     * @param out destination array
+     * @return pointer past the last written element
+     * @pre `out` can hold `size()` elements
+     */
+    value_type* copy_to(value_type* out) const noexcept
+    {
+        SBEPP_ASSERT(out != nullptr);
+        const auto count = size();
+        SBEPP_SIZE_CHECK(
+            (*this)(addressof_tag{}),
+            (*this)(end_ptr_tag{}),
+            0,
+            sizeof(size_type) + sizeof(value_type) * count);
+        get_primitives<E>(
+            (*this)(addressof_tag{}) + sizeof(size_type), count, out);
+        return out + count;
+    }
+
+    /**
+     * @brief Replaces the contents of the container with `count` native
+     *  values, converting them to schema byte order
+     *
+     * @param values values to assign
+     * @param count number of values to assign
+     */
+    template<typename T = void, typename = enable_if_writable_t<Byte, T>>
+    void assign_from(const value_type* values, size_type count) const noexcept
+    {
+        SBEPP_ASSERT((values != nullptr) || !count);
+        resize(count, default_init);
+        SBEPP_SIZE_CHECK(
+            (*this)(addressof_tag{}),
+            (*this)(end_ptr_tag{}),
+            0,
+            sizeof(size_type) + sizeof(value_type) * count);
+        set_primitives<E>(
+            (*this)(addressof_tag{}) + sizeof(size_type), values, count);
+    }
+
     /**
      * @brief Assigns range
      *
@@ -4021,6 +4571,25 @@ constexpr auto fill_group_header(Group g, Size num_in_group) noexcept
     return g(detail::fill_group_header_tag{}, num_in_group);
 }
 
+/**
+ * @brief Reads all fixed-size fields of a message or group entry at once
+ *
+ * Returns an aggregate generated by `sbeppc` for each message and group entry
+ * which has a member of the same name and type as the corresponding accessor
+ * returns. Fields represented by views (composites and arrays) and constants
+ * are not included. The block size is checked only once and all fields are
+ * converted from schema byte order in a single pass.
+ *
+ * @param v message or group entry
+ * @return native representation of fixed-size fields
+ */
+template<typename View>
+constexpr auto load_block(View v) noexcept
+    -> decltype(v(detail::load_block_tag{}))
+{
+    return v(detail::load_block_tag{});
+}
+
 /** @addtogroup traits-list Traits list
  *
  *  The list of available traits. For more details see @ref traits
@@ -4148,6 +4717,24 @@ public:
     using type_tags = sbepp::type_list<TypeTags...>;
     //! @brief Schema message tags in schema order
     using message_tags = sbepp::type_list<MessageTags...>;
+
+    /**
+     * @brief Calls `visitor` with the view of message with the given
+     *  `template_id`. Normally, `sbepp::dispatch()` should be used instead.
+     *
+     * @param template_id message ID
+     * @param data buffer start
+     * @param size buffer size
+     * @param visitor callable which accepts all schema message views
+     * @return `true` if `template_id` corresponds to a schema message and
+     *  `visitor` was called, `false` otherwise
+     */
+    template<typename Byte, typename Visitor>
+    static constexpr bool dispatch(
+        message_id_t template_id,
+        Byte* data,
+        std::size_t size,
+        Visitor&& visitor);
 };
 #endif
 
@@ -4335,6 +4922,41 @@ public:
 };
 #endif
 
+/**
+ * @brief Value returned by `max_size_bytes()` traits when maximum size doesn't
+ *  fit into `std::size_t` or isn't limited by the schema
+ */
+SBEPP_CPP17_INLINE_VAR constexpr std::size_t unbounded_size_bytes =
+    std::numeric_limits<std::size_t>::max();
+
+namespace detail
+{
+constexpr std::size_t
+    saturating_add(const std::size_t a, const std::size_t b) noexcept
+{
+    return (a > unbounded_size_bytes - b) ? unbounded_size_bytes : (a + b);
+}
+
+constexpr std::size_t
+    saturating_mul(const std::size_t a, const std::size_t b) noexcept
+{
+    return (a && (b > unbounded_size_bytes / a)) ? unbounded_size_bytes
+                                                 : (a * b);
+}
+
+constexpr std::size_t saturating_sum(const std::size_t a) noexcept
+{
+    return a;
+}
+
+template<typename... Ts>
+constexpr std::size_t saturating_sum(
+    const std::size_t a, const std::size_t b, const Ts... rest) noexcept
+{
+    return saturating_sum(saturating_add(a, b), rest...);
+}
+} // namespace detail
+
 /**
  * @brief Provides various traits/attributes of a `<message>` element.
  *
@@ -4454,6 +5076,19 @@ public:
      *  schema version.
      */
     static constexpr std::size_t size_bytes(...) noexcept;
+    /**
+     * @brief Returns the maximum number of bytes required to represent the
+     *  message
+     *
+     * Calculated using `maxValue` of `numInGroup` and data `length` types.
+     * If `numInGroup` has no `maxValue`, its primitive type maximum is used.
+     * Data without `length` `maxValue` is unbounded and so is every level
+     * which contains it. Useful to size buffers at compile time.
+     *
+     * @return size in bytes or `sbepp::unbounded_size_bytes` if it doesn't fit
+     *  into `std::size_t`
+     */
+    static constexpr std::size_t max_size_bytes() noexcept;
     //! @brief Top-level field tags in schema order
     using field_tags = sbepp::type_list<FieldTags...>;
     //! @brief Top-level group tags in schema order
@@ -4579,6 +5214,11 @@ public:
      */
     static constexpr std::size_t
         size_bytes(const NumInGroupType num_in_group, ...) noexcept;
+    /**
+     * @brief Returns the maximum number of bytes required to represent the
+     *  group, see `message_traits::max_size_bytes()`
+     */
+    static constexpr std::size_t max_size_bytes() noexcept;
     //! @brief Current-level field tags in schema order
     using field_tags = sbepp::type_list<FieldTags...>;
     //! @brief Current-level group tags in schema order
@@ -4634,6 +5274,12 @@ public:
      */
     static constexpr std::size_t
         size_bytes(const length_type::value_type size) noexcept;
+    /**
+     * @brief Returns the maximum number of bytes required to represent
+     *  `<data>`, i.e. `size_bytes(length_type::max_value())`, or
+     *  `sbepp::unbounded_size_bytes` if `length` has no explicit `maxValue`
+     */
+    static constexpr std::size_t max_size_bytes() noexcept;
 };
 #endif
 /** @} */
@@ -4677,8 +5323,13 @@ struct traits_tag
 template<typename ValueType>
 using traits_tag_t = typename traits_tag<ValueType>::type;
 
-template<typename Byte, typename Value, std::size_t N, typename Tag>
-struct traits_tag<detail::static_array_ref<Byte, Value, N, Tag>>
+template<
+    typename Byte,
+    typename Value,
+    std::size_t N,
+    typename Tag,
+    endian E>
+struct traits_tag<detail::static_array_ref<Byte, Value, N, Tag, E>>
 {
     using type = Tag;
 };
@@ -4956,6 +5607,151 @@ constexpr View<typename std::add_const<Byte>::type>
     return {ptr, size};
 }
 
+/**
+ * @brief Constructs view which is never size-checked
+ *
+ * Normally, when size checks are enabled, views remember the end of the
+ * provided buffer and assert that all accesses are within it. Views created by
+ * this function, and all views obtained from them (fields, groups, entries,
+ * data members), skip these checks. This allows to have checked decoding of
+ * untrusted input and assertion-free access to trusted data (e.g. produced by
+ * the same process) within a single binary.
+ *
+ * @note This is a runtime property of a view, not a compile-time policy.
+ *  The view gets null end pointer, `end - begin` then wraps around to a value
+ *  larger than any buffer so `SBEPP_SIZE_CHECK` passes for all accesses
+ *  without a separate branch, checks of normal views are not affected. When
+ *  size checks are disabled, it's equivalent to `sbepp::make_view`.
+ *
+ * Example:
+ * ```cpp
+ * // buffer validity is guaranteed by the producer
+ * auto m = sbepp::make_unchecked_view<some_schema::messages::msg1>(ptr);
+ * ```
+ *
+ * @tparam View view template
+ * @tparam Byte byte type
+ * @param ptr buffer start
+ * @return constructed view
+ */
+template<template<typename> class View, typename Byte>
+constexpr View<Byte> make_unchecked_view(Byte* ptr) noexcept
+{
+    return {ptr, static_cast<Byte*>(nullptr)};
+}
+
+/**
+ * @brief Constructs read-only view which is never size-checked
+ *
+ * Read-only version of `sbepp::make_unchecked_view`.
+ *
+ * @tparam View view template
+ * @tparam Byte byte type
+ * @param ptr buffer start
+ * @return constructed view
+ */
+template<template<typename> class View, typename Byte>
+constexpr View<typename std::add_const<Byte>::type>
+    make_unchecked_const_view(Byte* ptr) noexcept
+{
+    return {ptr, static_cast<typename std::add_const<Byte>::type*>(nullptr)};
+}
+
+namespace detail
+{
+// called from generated `schema_traits::dispatch()`
+template<typename MessageTag, typename Byte, typename Visitor>
+SBEPP_CPP14_CONSTEXPR void
+    dispatch_message(Byte* data, const std::size_t size, Visitor& visitor)
+{
+    visitor(sbepp::make_view<message_traits<MessageTag>::template value_type>(
+        data, size));
+}
+} // namespace detail
+
+//! @brief Result of `sbepp::dispatch()`
+enum class dispatch_result
+{
+    //! visitor was called with the message view
+    dispatched,
+    //! `templateId` doesn't match any schema message
+    unknown_template_id,
+    //! `schemaId` doesn't match `sbepp::schema_traits::id()`
+    wrong_schema_id,
+    //! `version` is newer than `sbepp::schema_traits::version()`
+    unsupported_version,
+    //! buffer is too small to hold the message header
+    incomplete_header
+};
+
+//! @brief Optional message header checks performed by `sbepp::dispatch()`
+struct dispatch_options
+{
+    //! Check that header's `schemaId` matches `sbepp::schema_traits::id()`
+    bool check_schema_id;
+    //! Check that header's `version` is not newer than
+    //! `sbepp::schema_traits::version()`
+    bool check_version;
+};
+
+/**
+ * @brief Calls `visitor` with the message view corresponding to the message
+ *  header's `templateId`
+ *
+ * Lookup is performed by `switch` generated by `sbeppc` so it doesn't depend
+ * on the number of schema messages. Example:
+ * ```cpp
+ * auto res = sbepp::dispatch<market::schema>(data, size, overloaded{
+ *     [](market::messages::msg1<const char> m){},
+ *     [](auto){} // not interested in other messages
+ * });
+ * ```
+ *
+ * @tparam SchemaTag schema tag
+ * @param data buffer start
+ * @param size buffer size
+ * @param visitor callable which accepts all schema message views, its return
+ *  value is ignored
+ * @param options optional header checks, performed before `templateId` lookup
+ * @return `sbepp::dispatch_result::dispatched` if `visitor` was called, error
+ *  otherwise. `sbepp::dispatch_result::incomplete_header` if `size` is less
+ *  than the message header size, in that case the header is not accessed.
+ */
+template<typename SchemaTag, typename Byte, typename Visitor>
+SBEPP_CPP14_CONSTEXPR dispatch_result dispatch(
+    Byte* data,
+    const std::size_t size,
+    Visitor&& visitor,
+    const dispatch_options options = {})
+{
+    using traits = schema_traits<SchemaTag>;
+    using header_tag = typename traits::header_type_tag;
+    if(size < composite_traits<header_tag>::size_bytes())
+    {
+        return dispatch_result::incomplete_header;
+    }
+
+    const auto header =
+        sbepp::make_view<traits::template header_type>(data, size);
+
+    if(options.check_schema_id && (*header.schemaId() != traits::id()))
+    {
+        return dispatch_result::wrong_schema_id;
+    }
+
+    if(options.check_version && (*header.version() > traits::version()))
+    {
+        return dispatch_result::unsupported_version;
+    }
+
+    if(!traits::dispatch(*header.templateId(), data, size, visitor))
+    {
+        return dispatch_result::unknown_template_id;
+    }
+
+    return dispatch_result::dispatched;
+}
+
 /**
  * @brief Tag for unknown enum values
  *
@@ -4996,9 +5792,14 @@ struct is_array_type_impl
 {
     static constexpr std::false_type test(...);
 
-    template<typename T1, typename T2, std::size_t N, typename T3>
+    template<
+        typename T1,
+        typename T2,
+        std::size_t N,
+        typename T3,
+        endian E>
     static constexpr std::true_type
-        test(detail::static_array_ref<T1, T2, N, T3>*);
+        test(detail::static_array_ref<T1, T2, N, T3, E>*);
 
     using type = decltype(test(std::declval<Derived*>()));
 };
@@ -5577,12 +6378,24 @@ SBEPP_DEPRECATED constexpr auto
 
 namespace detail
 {
+// used when offsets of groups and data are not needed
+struct null_offset_recorder
+{
+    template<typename Byte>
+    SBEPP_CPP14_CONSTEXPR void operator()(Byte*, std::size_t) const noexcept
+    {
+    }
+};
+
+// `Recorder` is called with the address and nesting depth of each group and
+// data member
+template<typename Recorder>
 class size_bytes_checked_visitor
 {
 public:
-    constexpr explicit size_bytes_checked_visitor(
-        const std::size_t size) noexcept
-        : size{size}
+    constexpr size_bytes_checked_visitor(
+        const std::size_t size, Recorder recorder) noexcept
+        : size{size}, recorder{recorder}
     {
     }
 
@@ -5607,16 +6420,19 @@ public:
     template<typename T, typename Cursor, typename Tag>
     SBEPP_CPP14_CONSTEXPR bool on_group(T g, Cursor& c, Tag) noexcept
     {
-        const auto header = sbepp::get_header(g);
-        const auto header_size = sbepp::size_bytes(header);
-        if(!validate_and_subtract(header_size))
+        // header should be validated before it's accessed
+        if(!validate_and_subtract(unchecked_header_size(g)))
         {
             return true;
         }
+        const auto header = sbepp::get_header(g);
 
+        recorder(sbepp::addressof(g), depth);
         const auto prev_block_length =
             set_group_block_length(*header.blockLength());
+        depth++;
         sbepp::visit_children(g, c, *this);
+        depth--;
         set_group_block_length(prev_block_length);
 
         return !is_valid();
@@ -5636,6 +6452,13 @@ public:
     template<typename T, typename Tag>
     SBEPP_CPP14_CONSTEXPR bool on_data(T d, Tag) noexcept
     {
+        recorder(sbepp::addressof(d), depth);
+        // length should be validated before it's accessed
+        if(size < sizeof(typename T::size_type))
+        {
+            valid = false;
+            return true;
+        }
         return !validate_and_subtract(sbepp::size_bytes(d));
     }
 
@@ -5667,9 +6490,12 @@ public:
 
 private:
     std::size_t size;
+    Recorder recorder;
     bool valid{true};
     // current group's blockLength, used to validate entry
     std::size_t group_block_length{};
+    // nesting level of the current group or data member, `0` for top-level ones
+    std::size_t depth{};
 
     SBEPP_CPP14_CONSTEXPR bool
         validate_and_subtract(const std::size_t n) noexcept
@@ -5697,6 +6523,29 @@ struct size_bytes_checked_result
     std::size_t size;
 };
 
+namespace detail
+{
+template<typename View, typename Recorder>
+SBEPP_CPP20_CONSTEXPR size_bytes_checked_result size_bytes_checked_impl(
+    View view, std::size_t size, Recorder recorder) noexcept
+{
+    // `init_cursor` skips header, we need to ensure there's enough space for it
+    if(!sbepp::addressof(view) || (size < unchecked_header_size(view)))
+    {
+        return {};
+    }
+
+    size_bytes_checked_visitor<Recorder> visitor{size, recorder};
+    auto c = sbepp::init_cursor(view);
+    sbepp::visit(view, c, visitor);
+    if(visitor.is_valid())
+    {
+        return {true, size - visitor.get_size()};
+    }
+    return {};
+}
+} // namespace detail
+
 /**
  * @brief Calculates `view` size with additional safety checks.
  *
@@ -5711,20 +6560,8 @@ template<typename View>
 SBEPP_CPP20_CONSTEXPR size_bytes_checked_result
     size_bytes_checked(View view, std::size_t size) noexcept
 {
-    // `init_cursor` skips header, we need to ensure there's enough space for it
-    if(!sbepp::addressof(view) || (size < detail::get_header_size(view)))
-    {
-        return {};
-    }
-
-    detail::size_bytes_checked_visitor visitor{size};
-    auto c = sbepp::init_cursor(view);
-    sbepp::visit(view, c, visitor);
-    if(visitor.is_valid())
-    {
-        return {true, size - visitor.get_size()};
-    }
-    return {};
+    return detail::size_bytes_checked_impl(
+        view, size, detail::null_offset_recorder{});
 }
 
 /**
@@ -5800,48 +6637,3939 @@ constexpr auto set_by_tag(View view, Value&& value, Cursor&& c)
         std::forward<Cursor>(c));
 }
 
+template<typename Group>
+class group_encoder;
+
+template<typename Entry>
+class entry_encoder;
+
 namespace detail
 {
-template<template<typename> class Trait, typename T, typename = void_t<>>
-struct has_traits : std::false_type
+// base class for message and entry encoders, `Derived` should implement
+// `get_cursor()` which returns cursor to the current write position
+template<typename Derived, typename View>
+class level_encoder_base
 {
-};
+public:
+    //! @brief Message or entry view type
+    using view_type = View;
 
-template<template<typename> class Trait, typename T>
-struct has_traits<Trait, T, void_t<decltype(Trait<T>{})>> : std::true_type
-{
-};
-} // namespace detail
+    //! @brief Byte type
+    using byte_type = byte_type_t<View>;
 
-/**
- * @brief Checks if `Tag` is a type tag
- *
- * Equivalent to `std::true_type` if `Tag` is a type tag, `std::false_type`
- * otherwise. Requires `Tag` traits to be available for correct behavior.
- */
-template<typename Tag>
-using is_type_tag = detail::has_traits<type_traits, Tag>;
+    //! @brief Encoder type for `Tag` group
+    template<typename Tag>
+    using group_encoder_t =
+        group_encoder<decltype(sbepp::get_by_tag<Tag>(std::declval<View>()))>;
 
-/**
- * @brief Checks if `Tag` is an enum tag
- *
- * Equivalent to `std::true_type` if `Tag` is an enum tag, `std::false_type`
- * otherwise. Requires `Tag` traits to be available for correct behavior.
- */
-template<typename Tag>
-using is_enum_tag = detail::has_traits<enum_traits, Tag>;
+    //! @brief Returns underlying view
+    constexpr View view() const noexcept
+    {
+        return v;
+    }
 
-/**
- * @brief Checks if `Tag` is an enum value tag
- *
- * Equivalent to `std::true_type` if `Tag` is an enum value tag,
- * `std::false_type` otherwise. Requires `Tag` traits to be available for
- * correct behavior.
- */
-template<typename Tag>
-using is_enum_value_tag = detail::has_traits<enum_value_traits, Tag>;
+    /**
+     * @brief Sets field value by tag. Fields can be set in any order.
+     *
+     * @tparam Tag field tag
+     * @param value value to set
+     * @return `*this`
+     */
+    template<typename Tag, typename Value>
+    SBEPP_CPP20_CONSTEXPR Derived& set(Value&& value) noexcept
+    {
+        sbepp::set_by_tag<Tag>(v, std::forward<Value>(value));
+        return derived();
+    }
 
-/**
+    /**
+     * @brief Starts encoding of `Tag` group
+     *
+     * Group header is filled with `numInGroup == 0`, entries are added using
+     * `sbepp::group_encoder::emplace_back()`.
+     *
+     * @tparam Tag group tag
+     * @return group encoder
+     * @pre all preceding groups and data members are encoded
+     */
+    template<typename Tag>
+    SBEPP_CPP20_CONSTEXPR group_encoder_t<Tag> group() noexcept
+    {
+        auto& c = derived().get_cursor();
+        const auto g =
+            sbepp::get_by_tag<Tag>(v, sbepp::cursor_ops::dont_move(c));
+        sbepp::fill_group_header(g, 0);
+        // empty group consists only of its header
+        c.pointer() += sbepp::size_bytes(g);
+
+        return group_encoder_t<Tag>{g, c};
+    }
+
+    /**
+     * @brief Encodes `Tag` data member from a range
+     *
+     * @tparam Tag data tag
+     * @param r range to assign, see `sbepp::dynamic_array_ref::assign_range()`
+     * @return `*this`
+     * @pre all preceding groups and data members are encoded
+     */
+    template<typename Tag, typename R>
+    SBEPP_CPP20_CONSTEXPR Derived& assign_range(R&& r)
+    {
+        auto& c = derived().get_cursor();
+        const auto d =
+            sbepp::get_by_tag<Tag>(v, sbepp::cursor_ops::dont_move(c));
+        d.assign_range(std::forward<R>(r));
+        c.pointer() += sbepp::size_bytes(d);
+
+        return derived();
+    }
+
+    /**
+     * @brief Encodes `Tag` data member from a null-terminated string
+     *
+     * @tparam Tag data tag
+     * @param str null-terminated string
+     * @return `*this`
+     * @pre all preceding groups and data members are encoded
+     * @pre `str != nullptr`
+     */
+    template<typename Tag>
+    SBEPP_CPP20_CONSTEXPR Derived& assign_string(const char* str) noexcept
+    {
+        auto& c = derived().get_cursor();
+        const auto d =
+            sbepp::get_by_tag<Tag>(v, sbepp::cursor_ops::dont_move(c));
+        d.assign_string(str);
+        c.pointer() += sbepp::size_bytes(d);
+
+        return derived();
+    }
+
+protected:
+    ~level_encoder_base() = default;
+
+    level_encoder_base() = default;
+
+    explicit constexpr level_encoder_base(const View view) noexcept : v{view}
+    {
+    }
+
+private:
+    View v{};
+
+    SBEPP_CPP14_CONSTEXPR Derived& derived() noexcept
+    {
+        return static_cast<Derived&>(*this);
+    }
+};
+} // namespace detail
+
+/**
+ * @brief Forward-only message encoder which tracks the current write position
+ *
+ * Fields are set using normal accessors so they can be set in any order.
+ * Groups and data members must be encoded in schema order, group headers are
+ * filled automatically. Since the encoder knows where the message ends,
+ * `size()` has constant complexity even for messages with groups and data.
+ *
+ * Example:
+ * ```cpp
+ * auto enc = sbepp::make_encoder(
+ *     sbepp::make_view<market::messages::msg>(buf.data(), buf.size()));
+ * enc.set<market::schema::messages::msg::field>(1);
+ * auto g = enc.group<market::schema::messages::msg::group>();
+ * for(const auto value : values)
+ * {
+ *     g.emplace_back().set<market::schema::messages::msg::group::field>(
+ *         value);
+ * }
+ * enc.assign_string<market::schema::messages::msg::data>("hi!");
+ * send(sbepp::addressof(enc.view()), enc.size());
+ * ```
+ *
+ * @tparam Message message view type
+ *
+ * @warning Group and entry encoders refer to the cursor stored in the message
+ *  encoder so it's not copyable. It's movable only to be returned from
+ *  `sbepp::make_encoder()`, moving it invalidates all group and entry
+ *  encoders obtained from it, using them after that triggers an assertion.
+ */
+template<typename Message>
+class message_encoder
+    : public detail::level_encoder_base<message_encoder<Message>, Message>
+{
+    using base_type =
+        detail::level_encoder_base<message_encoder<Message>, Message>;
+
+public:
+    message_encoder() = default;
+
+    message_encoder(const message_encoder&) = delete;
+    message_encoder& operator=(const message_encoder&) = delete;
+
+    //! @brief Takes over the encoding, `other` becomes empty
+    SBEPP_CPP14_CONSTEXPR message_encoder(message_encoder&& other) noexcept
+        : base_type{other.view()}, c{other.c}
+    {
+        other.c = {};
+    }
+
+    //! @brief Takes over the encoding, `other` becomes empty
+    SBEPP_CPP14_CONSTEXPR message_encoder&
+        operator=(message_encoder&& other) noexcept
+    {
+        if(this != &other)
+        {
+            base_type::operator=(other);
+            c = other.c;
+            other.c = {};
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Constructs from a message view, fills its header
+     *
+     * @param m message view
+     */
+    SBEPP_CPP20_CONSTEXPR explicit message_encoder(const Message m) noexcept
+        : base_type{m}, c{sbepp::init_cursor(m)}
+    {
+        sbepp::fill_message_header(m);
+        c.pointer() += *sbepp::get_header(m).blockLength();
+    }
+
+    //! @brief Returns the size of the encoded part of the message
+    constexpr std::size_t size() const noexcept
+    {
+        return sbepp::size_bytes(this->view(), c);
+    }
+
+private:
+    friend base_type;
+
+    cursor<byte_type_t<Message>> c{};
+
+    SBEPP_CPP14_CONSTEXPR cursor<byte_type_t<Message>>&
+        get_cursor() noexcept
+    {
+        SBEPP_ASSERT(c.pointer());
+        return c;
+    }
+};
+
+/**
+ * @brief Encoder for group entries, see `sbepp::group_encoder::emplace_back()`
+ *
+ * @tparam Entry entry view type
+ */
+template<typename Entry>
+class entry_encoder
+    : public detail::level_encoder_base<entry_encoder<Entry>, Entry>
+{
+public:
+    entry_encoder() = default;
+
+    /**
+     * @brief Constructs from an entry view and a cursor
+     *
+     * @param e entry view
+     * @param c cursor which points right after the entry's block
+     */
+    constexpr entry_encoder(
+        const Entry e, cursor<byte_type_t<Entry>>& c) noexcept
+        : detail::level_encoder_base<entry_encoder<Entry>, Entry>{e}, c{&c}
+    {
+    }
+
+private:
+    friend detail::level_encoder_base<entry_encoder<Entry>, Entry>;
+
+    cursor<byte_type_t<Entry>>* c{};
+
+    SBEPP_CPP14_CONSTEXPR cursor<byte_type_t<Entry>>&
+        get_cursor() noexcept
+    {
+        SBEPP_ASSERT(c && c->pointer());
+        return *c;
+    }
+};
+
+/**
+ * @brief Group encoder, see `sbepp::message_encoder::group()`
+ *
+ * @tparam Group group view type
+ */
+template<typename Group>
+class group_encoder
+{
+public:
+    //! @brief Group view type
+    using group_type = Group;
+    //! @brief Entry encoder type
+    using value_type = entry_encoder<typename Group::value_type>;
+
+    group_encoder() = default;
+
+    /**
+     * @brief Constructs from a group view and a cursor
+     *
+     * @param g group view
+     * @param c cursor which points right after the group
+     */
+    constexpr group_encoder(
+        const Group g, cursor<byte_type_t<Group>>& c) noexcept
+        : g{g}, c{&c}
+    {
+    }
+
+    //! @brief Returns underlying group view
+    constexpr Group view() const noexcept
+    {
+        return g;
+    }
+
+    //! @brief Returns the number of added entries
+    SBEPP_CPP20_CONSTEXPR typename Group::size_type size() const noexcept
+    {
+        return g.size();
+    }
+
+    /**
+     * @brief Appends an entry and increments `numInGroup`
+     *
+     * @return encoder for the new entry
+     * @pre all members of the previous entry are encoded
+     * @pre `size() < g.max_size()`
+     */
+    SBEPP_CPP20_CONSTEXPR value_type emplace_back() const noexcept
+    {
+        SBEPP_ASSERT(c && c->pointer());
+        SBEPP_ASSERT(g.size() < g.max_size());
+        const auto block_length = *sbepp::get_header(g).blockLength();
+        SBEPP_SIZE_CHECK(
+            c->pointer(), g(detail::end_ptr_tag{}), 0, block_length);
+        const typename Group::value_type e{
+            c->pointer(), g(detail::end_ptr_tag{}), block_length};
+        c->pointer() += block_length;
+        g.resize(g.size() + 1);
+
+        return {e, *c};
+    }
+
+private:
+    Group g;
+    cursor<byte_type_t<Group>>* c{};
+};
+
+/**
+ * @brief Creates `sbepp::message_encoder` for the given message
+ *
+ * @param m message view
+ * @return message encoder
+ */
+template<typename Message>
+SBEPP_CPP20_CONSTEXPR message_encoder<Message>
+    make_encoder(const Message m) noexcept
+{
+    return message_encoder<Message>{m};
+}
+
+/**
+ * @brief Wrapper which allows resizing of groups and data members of already
+ *  encoded message
+ *
+ * Message size is calculated once on construction and then updated on each
+ * modification. When a member in the middle of the message changes its size,
+ * all the following bytes are moved with a single copy so the message stays
+ * consistent and there's no need to re-encode it from scratch.
+ *
+ * Example:
+ * ```cpp
+ * auto mm = sbepp::make_mutable_message(
+ *     sbepp::make_view<market::messages::msg>(buf.data(), buf.size()));
+ * mm.assign_string(mm.view().text(), "new text");
+ * auto g = mm.view().group();
+ * mm.resize(g, g.size() + 1);
+ * send(sbepp::addressof(mm.view()), mm.size());
+ * ```
+ *
+ * @tparam Message message view type
+ * @note all groups and data members passed to member functions should belong
+ *  to the wrapped message and should be obtained after the last modification
+ */
+template<typename Message>
+class mutable_message
+{
+public:
+    //! @brief Message view type
+    using view_type = Message;
+    //! @brief Byte type
+    using byte_type = byte_type_t<Message>;
+
+    mutable_message() = default;
+
+    /**
+     * @brief Constructs from a message view
+     *
+     * @param m encoded message view
+     */
+    SBEPP_CPP20_CONSTEXPR explicit mutable_message(const Message m) noexcept
+        : m{m}, message_size{sbepp::size_bytes(m)}
+    {
+    }
+
+    //! @brief Returns underlying view
+    constexpr Message view() const noexcept
+    {
+        return m;
+    }
+
+    //! @brief Returns the current message size
+    constexpr std::size_t size() const noexcept
+    {
+        return message_size;
+    }
+
+    /**
+     * @brief Sets data size to `count`, value initializes new elements
+     *
+     * @param d data member view
+     * @param count new size
+     */
+    template<typename Data>
+    SBEPP_CPP20_CONSTEXPR detail::enable_if_t<is_data<Data>::value>
+        resize(const Data d, const typename Data::size_type count) noexcept
+    {
+        const auto old_size = d.size();
+        resize_data(d, count);
+        if(count > old_size)
+        {
+            std::fill(
+                d.begin() + old_size, d.end(), typename Data::value_type{});
+        }
+    }
+
+    /**
+     * @brief Assigns null-terminated string to a data member
+     *
+     * @param d data member view
+     * @param str null-terminated string
+     * @pre `str != nullptr`
+     */
+    template<
+        typename Data,
+        typename = detail::enable_if_t<is_data<Data>::value>>
+    SBEPP_CPP20_CONSTEXPR void
+        assign_string(const Data d, const char* str) noexcept
+    {
+        SBEPP_ASSERT(str != nullptr);
+        const auto length = detail::string_length(str);
+        resize_data(d, static_cast<typename Data::size_type>(length));
+        std::copy_n(str, length, d.begin());
+    }
+
+    /**
+     * @brief Assigns range to a data member
+     *
+     * @param d data member view
+     * @param r range to assign, required to be a forward range
+     */
+    template<
+        typename Data,
+        typename R,
+        typename = detail::enable_if_t<
+            is_data<Data>::value && detail::is_range<R>::value>>
+    SBEPP_CPP20_CONSTEXPR void assign_range(const Data d, R&& r)
+    {
+#if SBEPP_HAS_RANGES
+        const auto length = std::ranges::distance(r);
+        resize_data(d, static_cast<typename Data::size_type>(length));
+        std::ranges::copy(std::forward<R>(r), d.begin());
+#else
+        const auto length = std::distance(std::begin(r), std::end(r));
+        resize_data(d, static_cast<typename Data::size_type>(length));
+        std::copy(std::begin(r), std::end(r), d.begin());
+#endif
+    }
+
+    /**
+     * @brief Sets group size to `count`
+     *
+     * Entries are added or removed at the end of the group, see
+     * `insert()` for the state of new entries.
+     *
+     * @param g group view
+     * @param count new size
+     * @pre `count <= g.max_size()`
+     */
+    template<typename Group>
+    SBEPP_CPP20_CONSTEXPR detail::enable_if_t<is_group<Group>::value>
+        resize(const Group g, const typename Group::size_type count) noexcept
+    {
+        const auto old_size = g.size();
+        if(count > old_size)
+        {
+            insert(
+                g,
+                g.end(),
+                static_cast<typename Group::size_type>(count - old_size));
+        }
+        else
+        {
+            erase(g, std::next(g.begin(), count), g.end());
+        }
+    }
+
+    /**
+     * @brief Inserts `count` entries before `pos`. See
+     *  `detail::flat_group_base::insert()` and
+     *  `detail::nested_group_base::insert()`.
+     *
+     * @param g group view
+     * @param pos iterator before which entries are inserted
+     * @param count number of entries to insert
+     * @return iterator to the first inserted entry
+     */
+    template<
+        typename Group,
+        typename = detail::enable_if_t<is_group<Group>::value>>
+    SBEPP_CPP20_CONSTEXPR typename Group::iterator insert(
+        const Group g,
+        const typename Group::iterator pos,
+        const typename Group::size_type count) noexcept
+    {
+        const auto old_size = sbepp::size_bytes(g);
+        const auto res = g.insert(pos, count, tail_end());
+        message_size += sbepp::size_bytes(g) - old_size;
+        return res;
+    }
+
+    /**
+     * @brief Erases entries in `[first; last)` range. See
+     *  `detail::flat_group_base::erase()` and
+     *  `detail::nested_group_base::erase()`.
+     *
+     * @param g group view
+     * @param first iterator to the first entry to erase
+     * @param last iterator past the last entry to erase
+     * @return iterator to the entry that followed the last erased one
+     */
+    template<
+        typename Group,
+        typename = detail::enable_if_t<is_group<Group>::value>>
+    SBEPP_CPP20_CONSTEXPR typename Group::iterator erase(
+        const Group g,
+        const typename Group::iterator first,
+        const typename Group::iterator last) noexcept
+    {
+        const auto old_size = sbepp::size_bytes(g);
+        const auto res = g.erase(first, last, tail_end());
+        message_size -= old_size - sbepp::size_bytes(g);
+        return res;
+    }
+
+private:
+    Message m{};
+    std::size_t message_size{};
+
+    constexpr byte_type* tail_end() const noexcept
+    {
+        return sbepp::addressof(m) + message_size;
+    }
+
+    // moves everything after `d` to its new end and sets its size
+    template<typename Data>
+    SBEPP_CPP20_CONSTEXPR void resize_data(
+        const Data d, const typename Data::size_type count) noexcept
+    {
+        const auto old_end = sbepp::addressof(d) + sbepp::size_bytes(d);
+        const auto new_end =
+            sbepp::addressof(d) + sizeof(typename Data::size_type) + count;
+        if(new_end > old_end)
+        {
+            const auto shift = static_cast<std::size_t>(new_end - old_end);
+            SBEPP_SIZE_CHECK(
+                tail_end(), m(detail::end_ptr_tag{}), 0, shift);
+            std::copy_backward(old_end, tail_end(), tail_end() + shift);
+            message_size += shift;
+        }
+        else
+        {
+            std::copy(old_end, tail_end(), new_end);
+            message_size -= static_cast<std::size_t>(old_end - new_end);
+        }
+        d.resize(count, default_init);
+    }
+};
+
+/**
+ * @brief Creates `sbepp::mutable_message` for the given message
+ *
+ * @param m encoded message view
+ * @return mutable message
+ */
+template<typename Message>
+SBEPP_CPP20_CONSTEXPR mutable_message<Message>
+    make_mutable_message(const Message m) noexcept
+{
+    return mutable_message<Message>{m};
+}
+
+/**
+ * @brief Pre-encoded message image
+ *
+ * Holds a copy of a fully encoded message. `encode()` copies it to the
+ * destination buffer using a single copy after which only fields that differ
+ * from the template need to be set. Field accessors write directly at
+ * compile-time offsets so there's no need for a special patcher. Can be
+ * created at compile-time when `SBEPP_HAS_CONSTEXPR_ACCESSORS == 1`.
+ *
+ * Example:
+ * ```cpp
+ * constexpr auto heartbeat_template =
+ *     sbepp::make_message_template<market::messages::heartbeat, 64>(
+ *         [](market::messages::heartbeat<std::uint8_t> m)
+ *         {
+ *             m.senderId(1);
+ *         });
+ *
+ * auto m = heartbeat_template.encode(buf.data(), buf.size());
+ * m.sequenceNumber(n);
+ * send(buf.data(), heartbeat_template.size());
+ * ```
+ *
+ * @tparam Message message view template
+ * @tparam N capacity in bytes
+ * @tparam Byte byte type of the internal storage
+ */
+template<
+    template<typename> class Message,
+    std::size_t N,
+    typename Byte = std::uint8_t>
+class message_template
+{
+public:
+    //! @brief Byte type of the internal storage
+    using byte_type = Byte;
+
+    /**
+     * @brief Encodes the template
+     *
+     * @param fill function which is called with `Message<Byte>` view after its
+     *  header is filled by `sbepp::fill_message_header()`
+     * @pre encoded message fits into `N` bytes
+     */
+    template<
+        typename F,
+        typename = detail::enable_if_t<!std::is_same<
+            typename std::decay<F>::type,
+            message_template>::value>>
+    SBEPP_CPP20_CONSTEXPR explicit message_template(F&& fill) noexcept(
+        noexcept(std::declval<F>()(std::declval<Message<Byte>>())))
+    {
+        const Message<Byte> m{storage.data(), storage.size()};
+        sbepp::fill_message_header(m);
+        std::forward<F>(fill)(m);
+        length = sbepp::size_bytes(m);
+    }
+
+    //! @brief Returns encoded message size
+    constexpr std::size_t size() const noexcept
+    {
+        return length;
+    }
+
+    //! @brief Returns pointer to encoded message
+    constexpr const Byte* data() const noexcept
+    {
+        return storage.data();
+    }
+
+    //! @brief Returns read-only view to the template
+    constexpr Message<const Byte> view() const noexcept
+    {
+        return {storage.data(), length};
+    }
+
+    /**
+     * @brief Copies the template to the buffer
+     *
+     * @param ptr buffer start
+     * @param size buffer size
+     * @return message view to the buffer
+     * @pre `size >= size()`
+     */
+    template<typename Byte2>
+    SBEPP_CPP20_CONSTEXPR Message<Byte2>
+        encode(Byte2* ptr, const std::size_t size) const noexcept
+    {
+        SBEPP_ASSERT(ptr != nullptr);
+        SBEPP_ASSERT(size >= length);
+        std::copy_n(storage.data(), length, ptr);
+        return {ptr, size};
+    }
+
+private:
+    std::array<Byte, N> storage{};
+    std::size_t length{};
+};
+
+/**
+ * @brief Creates `sbepp::message_template`
+ *
+ * @tparam Message message view template
+ * @tparam N capacity in bytes
+ * @tparam Byte byte type of the internal storage
+ * @param fill function which fills the message, see
+ *  `sbepp::message_template::message_template()`
+ * @return message template
+ */
+template<
+    template<typename> class Message,
+    std::size_t N,
+    typename Byte = std::uint8_t,
+    typename F>
+SBEPP_CPP20_CONSTEXPR message_template<Message, N, Byte>
+    make_message_template(F&& fill) noexcept(
+        noexcept(message_template<Message, N, Byte>{std::declval<F>()}))
+{
+    return message_template<Message, N, Byte>{std::forward<F>(fill)};
+}
+
+namespace detail
+{
+// size of message header and root block
+template<typename MessageTag>
+constexpr std::size_t fixed_message_size() noexcept
+{
+    return composite_traits<typename schema_traits<
+               typename message_traits<MessageTag>::schema_tag>::
+                                header_type_tag>::size_bytes()
+           + message_traits<MessageTag>::block_length();
+}
+} // namespace detail
+
+/**
+ * @brief Owning growable message buffer with inline storage
+ *
+ * Initially, the message is stored in the inline buffer which by default is
+ * large enough only for the message header and its root block. When more
+ * space is needed for groups or data members, `reserve()` moves the message to
+ * the memory obtained from `Allocator`.
+ *
+ * Example:
+ * ```cpp
+ * sbepp::message_buffer<market::messages::msg> buf;
+ * auto m = buf.view();
+ * sbepp::fill_message_header(m);
+ * m.field(1);
+ * buf.reserve(sbepp::message_traits<market::schema::messages::msg>::size_bytes(
+ *     entries.size(), data.size()));
+ * // views are invalidated by `reserve()`
+ * m = buf.view();
+ * ```
+ *
+ * @tparam Message message view template
+ * @tparam Allocator allocator with byte-like `value_type`, it's `pointer`
+ *  should be a raw pointer
+ * @tparam InlineSize size of the inline buffer
+ * @note moving a buffer which uses the inline buffer invalidates its views
+ */
+template<
+    template<typename> class Message,
+    typename Allocator = std::allocator<std::uint8_t>,
+    std::size_t InlineSize = detail::fixed_message_size<traits_tag_t<
+        Message<typename std::allocator_traits<Allocator>::value_type>>>()>
+class message_buffer
+{
+    using alloc_traits = std::allocator_traits<Allocator>;
+
+public:
+    //! @brief Allocator type
+    using allocator_type = Allocator;
+    //! @brief Byte type
+    using byte_type = typename alloc_traits::value_type;
+    //! @brief Message view type
+    using view_type = Message<byte_type>;
+    //! @brief Read-only message view type
+    using const_view_type = Message<const byte_type>;
+
+    //! @brief Constructs empty buffer which uses the inline buffer
+    message_buffer() = default;
+
+    //! @brief Constructs empty buffer with the given allocator
+    explicit message_buffer(const Allocator& alloc) noexcept : alloc{alloc}
+    {
+    }
+
+    //! @brief Copies content and capacity of `other`
+    message_buffer(const message_buffer& other)
+        : alloc{alloc_traits::select_on_container_copy_construction(
+            other.alloc)}
+    {
+        copy_from(other);
+    }
+
+    //! @brief Moves content of `other`, heap buffer is moved without copying
+    message_buffer(message_buffer&& other) noexcept
+        : alloc{std::move(other.alloc)}
+    {
+        move_from(other);
+    }
+
+    //! @brief Copies content of `other`, doesn't propagate its allocator
+    message_buffer& operator=(const message_buffer& other)
+    {
+        if(this != &other)
+        {
+            copy_from(other);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Moves content of `other`. Heap buffer is moved without copying if
+     *  allocators are equal or propagated on move assignment.
+     */
+    message_buffer& operator=(message_buffer&& other)
+    {
+        if(this == &other)
+        {
+            return *this;
+        }
+
+        using propagate_t =
+            typename alloc_traits::propagate_on_container_move_assignment;
+        if(other.heap && (propagate_t::value || alloc == other.alloc))
+        {
+            release();
+            move_allocator(other, propagate_t{});
+            move_from(other);
+        }
+        else
+        {
+            copy_from(other);
+        }
+        return *this;
+    }
+
+    ~message_buffer()
+    {
+        release();
+    }
+
+    //! @brief Returns the size of the inline buffer
+    static constexpr std::size_t inline_capacity() noexcept
+    {
+        return InlineSize;
+    }
+
+    //! @brief Returns current buffer size
+    std::size_t capacity() const noexcept
+    {
+        return cap;
+    }
+
+    //! @brief Checks if the inline buffer is used
+    bool is_inline() const noexcept
+    {
+        return !heap;
+    }
+
+    //! @brief Returns pointer to the buffer
+    byte_type* data() noexcept
+    {
+        return heap ? heap : storage.data();
+    }
+
+    //! @brief Returns pointer to the buffer
+    const byte_type* data() const noexcept
+    {
+        return heap ? heap : storage.data();
+    }
+
+    //! @brief Returns message view to the whole buffer
+    view_type view() noexcept
+    {
+        return {data(), cap};
+    }
+
+    //! @brief Returns read-only message view to the whole buffer
+    const_view_type view() const noexcept
+    {
+        return {data(), cap};
+    }
+
+    //! @brief Returns allocator
+    allocator_type get_allocator() const
+    {
+        return alloc;
+    }
+
+    /**
+     * @brief Ensures that buffer size is at least `size` bytes
+     *
+     * On growth, allocates at least twice the current capacity and copies the
+     * whole buffer to the new memory, new bytes are zero-initialized. All
+     * views are invalidated in this case.
+     *
+     * @param size required buffer size
+     */
+    void reserve(const std::size_t size)
+    {
+        if(size > cap)
+        {
+            grow(std::max(size, cap * 2));
+        }
+    }
+
+private:
+    std::array<byte_type, InlineSize> storage{};
+    byte_type* heap{};
+    std::size_t cap{InlineSize};
+    Allocator alloc{};
+
+    void release() noexcept
+    {
+        if(heap)
+        {
+            alloc_traits::deallocate(alloc, heap, cap);
+            heap = nullptr;
+            cap = InlineSize;
+        }
+    }
+
+    void grow(const std::size_t new_cap)
+    {
+        byte_type* ptr = alloc_traits::allocate(alloc, new_cap);
+        // filling only the tail triggers GCC 12 -Wstringop-overflow false
+        // positive
+        std::fill_n(ptr, new_cap, byte_type{});
+        std::copy_n(data(), cap, ptr);
+        release();
+        heap = ptr;
+        cap = new_cap;
+    }
+
+    void copy_from(const message_buffer& other)
+    {
+        if(other.cap > cap)
+        {
+            grow(other.cap);
+        }
+        std::copy_n(other.data(), other.cap, data());
+    }
+
+    // `alloc` should be already moved or equal to `other.alloc`
+    void move_from(message_buffer& other) noexcept
+    {
+        if(other.heap)
+        {
+            heap = other.heap;
+            cap = other.cap;
+            other.heap = nullptr;
+            other.cap = InlineSize;
+        }
+        else
+        {
+            storage = other.storage;
+        }
+    }
+
+    void move_allocator(message_buffer& other, std::true_type) noexcept
+    {
+        alloc = std::move(other.alloc);
+    }
+
+    void move_allocator(message_buffer&, std::false_type) noexcept
+    {
+    }
+};
+
+//! @brief Default `sbepp::gather_list` segment type, has the same members
+//!     as `iovec`
+struct gather_segment
+{
+    //! Pointer to segment bytes
+    void* iov_base;
+    //! Segment size in bytes
+    std::size_t iov_len;
+};
+
+namespace detail
+{
+template<typename SizeType, endian E>
+void set_external_data_size(
+    std::uint8_t* ptr, const std::size_t size) noexcept
+{
+    set_primitive<E>(ptr, static_cast<SizeType>(size));
+}
+} // namespace detail
+
+/**
+ * @brief Scatter-gather representation of a message with external `<data>`
+ *  payloads
+ *
+ * Payloads of `<data>` members added via `add_external()` are not copied
+ * into the message buffer. Instead, such members stay empty while message is
+ * encoded, and `finish()` sets their real sizes and builds the list of
+ * segments which alternate between message buffer parts and external
+ * payloads. Segments can be passed directly to `writev`/`sendmsg`.
+ *
+ * Example:
+ * ```cpp
+ * sbepp::gather_list<1, iovec> io;
+ * auto m = sbepp::make_view<market::messages::msg>(buf.data(), buf.size());
+ * sbepp::fill_message_header(m);
+ * // encode fields and groups...
+ * io.add_external(m.data(), payload.data(), payload.size());
+ * io.finish(m);
+ * writev(fd, io.data(), io.size());
+ * ```
+ *
+ * @tparam N max number of external payloads
+ * @tparam Segment segment type, should be aggregate-initializable from
+ *  `{void*, std::size_t}`, like `iovec`
+ * @note after `finish()`, the message in buffer is not valid on its own, its
+ *  `<data>` sizes refer to external payloads, see `finish()`
+ */
+template<std::size_t N, typename Segment = gather_segment>
+class gather_list
+{
+    static_assert(N != 0, "N should be greater than 0");
+
+public:
+    //! @brief Segment type
+    using segment_type = Segment;
+
+    //! @brief Returns max number of external payloads
+    static constexpr std::size_t max_external() noexcept
+    {
+        return N;
+    }
+
+    //! @brief Returns max number of segments
+    static constexpr std::size_t max_segments() noexcept
+    {
+        return 2 * N + 1;
+    }
+
+    /**
+     * @brief Adds external payload for `<data>` member `d`
+     *
+     * `d` is left empty so the following members can be encoded as usual.
+     * Payload should remain valid until segments are written.
+     *
+     * @param d `<data>` member
+     * @param payload pointer to payload elements
+     * @param count number of elements in payload
+     * @pre `external_count() < max_external()`
+     * @pre `d` is located after previously added members
+     * @pre `count <= d.max_size()`
+     * @pre `finish()` was not called since construction or `clear()`
+     */
+    template<typename Byte, typename Value, typename Length, endian E>
+    void add_external(
+        const detail::dynamic_array_ref<Byte, Value, Length, E> d,
+        const Value* payload,
+        const std::size_t count) noexcept
+    {
+        static_assert(!std::is_const<Byte>::value, "d should be writable");
+        using size_type = typename Length::value_type;
+        SBEPP_ASSERT(!finished);
+        SBEPP_ASSERT(external_count() < max_external());
+        SBEPP_ASSERT(count <= d.max_size());
+        const auto ptr = reinterpret_cast<std::uint8_t*>(sbepp::addressof(d));
+        SBEPP_ASSERT(
+            !externals_size || (externals[externals_size - 1].ptr < ptr));
+        d.clear();
+        externals[externals_size] = {
+            ptr,
+            payload,
+            count,
+            count * sizeof(Value),
+            &detail::set_external_data_size<size_type, E>,
+            sizeof(size_type)};
+        externals_size++;
+    }
+
+    //! @brief Returns number of added external payloads
+    std::size_t external_count() const noexcept
+    {
+        return externals_size;
+    }
+
+    /**
+     * @brief Sets sizes of external `<data>` members and builds segments
+     *
+     * Subsequent calls do nothing until `clear()` is called.
+     *
+     * @param m fully encoded message view
+     * @pre all external members belong to `m`
+     * @warning After this call, `m` is not self-consistent: its external
+     *  `<data>` sizes include payloads which are not in the buffer, so
+     *  `sbepp::size_bytes(m)` and access to members located after the first
+     *  external `<data>` give wrong results. Use segments to send it.
+     */
+    template<typename Message>
+    void finish(const Message& m) noexcept
+    {
+        if(finished)
+        {
+            return;
+        }
+        finished = true;
+
+        // should be calculated before external sizes are set
+        const auto message_size = sbepp::size_bytes(m);
+        const auto begin =
+            reinterpret_cast<const std::uint8_t*>(sbepp::addressof(m));
+        const auto end = begin + message_size;
+        auto first = begin;
+        segments_size = 0;
+        total_size = message_size;
+        for(std::size_t i = 0; i != externals_size; i++)
+        {
+            const auto& ext = externals[i];
+            SBEPP_ASSERT((ext.ptr >= begin) && (ext.ptr < end));
+            if(!ext.count)
+            {
+                continue;
+            }
+            ext.set_size(ext.ptr, ext.count);
+            const auto last = ext.ptr + ext.size_field_size;
+            add_segment(first, last - first);
+            add_segment(ext.payload, ext.size);
+            first = last;
+            total_size += ext.size;
+        }
+        add_segment(first, end - first);
+    }
+
+    //! @brief Removes all external payloads and segments
+    void clear() noexcept
+    {
+        externals_size = 0;
+        segments_size = 0;
+        total_size = 0;
+        finished = false;
+    }
+
+    //! @brief Returns pointer to the first segment
+    const segment_type* data() const noexcept
+    {
+        return segments.data();
+    }
+
+    //! @brief Returns number of segments built by `finish()`
+    std::size_t size() const noexcept
+    {
+        return segments_size;
+    }
+
+    //! @brief Returns total size of all segments in bytes
+    std::size_t size_bytes() const noexcept
+    {
+        return total_size;
+    }
+
+    //! @brief Returns iterator to the first segment
+    const segment_type* begin() const noexcept
+    {
+        return segments.data();
+    }
+
+    //! @brief Returns iterator to the end of segments
+    const segment_type* end() const noexcept
+    {
+        return segments.data() + segments_size;
+    }
+
+private:
+    struct external_payload
+    {
+        std::uint8_t* ptr;
+        const void* payload;
+        std::size_t count;
+        std::size_t size;
+        void (*set_size)(std::uint8_t*, std::size_t);
+        std::size_t size_field_size;
+    };
+
+    std::array<external_payload, N> externals{};
+    std::size_t externals_size{};
+    std::array<segment_type, 2 * N + 1> segments{};
+    std::size_t segments_size{};
+    std::size_t total_size{};
+    bool finished{};
+
+    void add_segment(const void* ptr, const std::size_t size) noexcept
+    {
+        if(size)
+        {
+            segments[segments_size] = segment_type{
+                const_cast<void*>(ptr), size};
+            segments_size++;
+        }
+    }
+};
+
+namespace detail
+{
+constexpr std::size_t empty_groups_size(type_list<>) noexcept
+{
+    return 0;
+}
+
+template<typename Tag, typename... Tags>
+constexpr std::size_t empty_groups_size(type_list<Tag, Tags...>) noexcept
+{
+    return composite_traits<
+               typename group_traits<Tag>::dimension_type_tag>::size_bytes()
+           + empty_groups_size(type_list<Tags...>{});
+}
+
+constexpr std::size_t empty_data_size(type_list<>) noexcept
+{
+    return 0;
+}
+
+template<typename Tag, typename... Tags>
+constexpr std::size_t empty_data_size(type_list<Tag, Tags...>) noexcept
+{
+    return data_traits<Tag>::size_bytes(0)
+           + empty_data_size(type_list<Tags...>{});
+}
+
+template<typename Entry>
+constexpr std::size_t empty_entry_size(const std::size_t block_length) noexcept
+{
+    using traits = group_traits<traits_tag_t<Entry>>;
+    return block_length + empty_groups_size(typename traits::group_tags{})
+           + empty_data_size(typename traits::data_tags{});
+}
+
+template<typename Encoder>
+SBEPP_CPP14_CONSTEXPR void fill_empty_groups(Encoder&, type_list<>) noexcept
+{
+}
+
+template<typename Encoder, typename Tag, typename... Tags>
+SBEPP_CPP20_CONSTEXPR void
+    fill_empty_groups(Encoder& enc, type_list<Tag, Tags...>) noexcept
+{
+    enc.template group<Tag>();
+    fill_empty_groups(enc, type_list<Tags...>{});
+}
+
+template<typename Entry, typename Byte, typename BlockLength>
+SBEPP_CPP20_CONSTEXPR void fill_empty_entries(
+    Byte* ptr,
+    Byte* end,
+    const std::size_t count,
+    const BlockLength block_length) noexcept
+{
+    const auto entry_size = empty_entry_size<Entry>(block_length);
+    // zeroes are valid `numInGroup` and data lengths, only nested group
+    // headers need to be filled explicitly
+    std::fill_n(ptr, count * entry_size, Byte{});
+    for(std::size_t i = 0; i != count; i++)
+    {
+        cursor<Byte> c;
+        c.pointer() = ptr + block_length;
+        entry_encoder<Entry> enc{Entry{ptr, end, block_length}, c};
+        fill_empty_groups(
+            enc, typename group_traits<traits_tag_t<Entry>>::group_tags{});
+        ptr += entry_size;
+    }
+}
+
+template<typename List1, typename List2>
+struct type_list_concat;
+
+template<typename... Ts, typename... Us>
+struct type_list_concat<type_list<Ts...>, type_list<Us...>>
+{
+    using type = type_list<Ts..., Us...>;
+};
+
+template<typename T, typename List>
+struct type_list_contains : std::false_type
+{
+};
+
+template<typename T, typename... Ts>
+struct type_list_contains<T, type_list<T, Ts...>> : std::true_type
+{
+};
+
+template<typename T, typename U, typename... Ts>
+struct type_list_contains<T, type_list<U, Ts...>>
+    : type_list_contains<T, type_list<Ts...>>
+{
+};
+
+// requires `T` to be in the `List`
+template<typename T, typename List>
+struct type_list_index;
+
+template<typename T, typename... Ts>
+struct type_list_index<T, type_list<T, Ts...>>
+    : std::integral_constant<std::size_t, 0>
+{
+};
+
+template<typename T, typename U, typename... Ts>
+struct type_list_index<T, type_list<U, Ts...>>
+    : std::integral_constant<
+          std::size_t,
+          1 + type_list_index<T, type_list<Ts...>>::value>
+{
+};
+
+template<typename List>
+struct type_list_first;
+
+template<typename T, typename... Ts>
+struct type_list_first<type_list<T, Ts...>>
+{
+    using type = T;
+};
+
+template<typename List>
+struct type_list_last;
+
+template<typename T>
+struct type_list_last<type_list<T>>
+{
+    using type = T;
+};
+
+template<typename T, typename U, typename... Ts>
+struct type_list_last<type_list<T, U, Ts...>>
+    : type_list_last<type_list<U, Ts...>>
+{
+};
+
+template<typename List>
+struct type_list_size;
+
+template<typename... Ts>
+struct type_list_size<type_list<Ts...>>
+    : std::integral_constant<std::size_t, sizeof...(Ts)>
+{
+};
+
+// groups always precede data so this is also the order of their appearance in
+// the message
+template<typename MessageTag>
+using dynamic_member_tags_t = typename type_list_concat<
+    typename message_traits<MessageTag>::group_tags,
+    typename message_traits<MessageTag>::data_tags>::type;
+
+template<typename Member, typename View>
+constexpr Member
+    get_member_view_at(const View view, const std::size_t offset) noexcept
+{
+    return {view(addressof_tag{}) + offset, view(end_ptr_tag{})};
+}
+
+template<typename View>
+SBEPP_CPP14_CONSTEXPR void
+    index_dynamic_members(View, std::size_t*, std::size_t, type_list<>) noexcept
+{
+}
+
+template<typename View, typename Tag, typename... Tags>
+SBEPP_CPP20_CONSTEXPR void index_dynamic_members(
+    const View view,
+    std::size_t* offsets,
+    const std::size_t offset,
+    type_list<Tag, Tags...>) noexcept
+{
+    using member_t = decltype(sbepp::get_by_tag<Tag>(view));
+    *offsets = offset;
+    const auto member = get_member_view_at<member_t>(view, offset);
+    index_dynamic_members(
+        view,
+        offsets + 1,
+        offset + sbepp::size_bytes(member),
+        type_list<Tags...>{});
+}
+} // namespace detail
+
+/**
+ * @brief Message view wrapper which caches offsets of groups and data members
+ *
+ * Each generated accessor for a non-first group or data member calculates the
+ * size of all the preceding groups and data members so reading `N` of them
+ * costs `O(N^2)`. `indexed_view` walks the message once and stores the
+ * offset of each group and data member, after that they are accessible in
+ * constant time via `get()` or `sbepp::get_by_tag()`. Other by-tag accesses are
+ * forwarded to the underlying message.
+ *
+ * Example:
+ * ```cpp
+ * auto m = sbepp::make_const_view<market::messages::order>(ptr, size);
+ * auto iv = sbepp::make_indexed_view(m);
+ * // doesn't walk `legs` group
+ * auto text = iv.get<market::schema::messages::order::text>();
+ * // or
+ * auto text2 = sbepp::get_by_tag<market::schema::messages::order::text>(iv);
+ * ```
+ *
+ * @tparam Message message view type
+ *
+ * @warning Offsets are not updated automatically, any change of group or data
+ *  member size invalidates them. Call `reindex()` after such a change.
+ */
+template<typename Message>
+class indexed_view
+{
+public:
+    static_assert(
+        is_message<Message>::value, "indexed_view requires a message view");
+
+    //! @brief Underlying message view type
+    using message_type = Message;
+    //! @brief Message tag
+    using tag_type = traits_tag_t<Message>;
+    //! @brief Group and data member tags, in order of their appearance
+    using dynamic_member_tags = detail::dynamic_member_tags_t<tag_type>;
+
+    //! @brief Member view type for group or data member `Tag`
+    template<typename Tag>
+    using member_type =
+        decltype(sbepp::get_by_tag<Tag>(std::declval<Message>()));
+
+    //! @brief Returns the number of cached offsets
+    static constexpr std::size_t dynamic_member_count() noexcept
+    {
+        return detail::type_list_size<dynamic_member_tags>::value;
+    }
+
+    //! @brief Type of cached offsets storage
+    using offsets_type = std::array<
+        std::size_t,
+        detail::type_list_size<dynamic_member_tags>::value>;
+
+    //! @brief Constructs an empty view which can only be assigned to
+    indexed_view() = default;
+
+    /**
+     * @brief Constructs from a message view and indexes it
+     *
+     * @param m message view, must not be empty
+     */
+    SBEPP_CPP20_CONSTEXPR explicit indexed_view(const Message m) noexcept
+        : msg{m}
+    {
+        reindex();
+    }
+
+    /**
+     * @brief Constructs from a message view and precomputed offsets without
+     *  walking the message
+     *
+     * @param m message view
+     * @param offsets offsets of group and data members in order of their
+     *  appearance, e.g. obtained from another `indexed_view` or
+     *  `sbepp::size_bytes_checked()`
+     */
+    constexpr indexed_view(
+        const Message m, const offsets_type& offsets) noexcept
+        : msg{m}, offsets{offsets}
+    {
+    }
+
+    /**
+     * @brief Recalculates cached offsets. Must be called after a change of
+     *  group or data member size.
+     */
+    SBEPP_CPP20_CONSTEXPR void reindex() noexcept
+    {
+        SBEPP_ASSERT(sbepp::addressof(msg));
+        index_impl(dynamic_member_tags{});
+    }
+
+    //! @brief Returns underlying message view
+    constexpr Message message() const noexcept
+    {
+        return msg;
+    }
+
+    //! @brief Returns cached offsets
+    constexpr const offsets_type& cached_offsets() const noexcept
+    {
+        return offsets;
+    }
+
+    /**
+     * @brief Returns offset of group or data member from the beginning of the
+     *  message
+     *
+     * @tparam Tag group or data member tag
+     */
+    template<typename Tag>
+    constexpr std::size_t offset_of() const noexcept
+    {
+        return offsets[detail::type_list_index<Tag, dynamic_member_tags>::
+                           value];
+    }
+
+    /**
+     * @brief Returns group or data member view in constant time
+     *
+     * @tparam Tag group or data member tag
+     */
+    template<typename Tag>
+    constexpr member_type<Tag> get() const noexcept
+    {
+        return detail::get_member_view_at<member_type<Tag>>(
+            msg, offset_of<Tag>());
+    }
+
+    /// @cond INTERNAL
+    template<
+        typename Tag,
+        typename = detail::enable_if_t<
+            detail::type_list_contains<Tag, dynamic_member_tags>::value>>
+    constexpr member_type<Tag>
+        operator()(detail::access_by_tag_tag, Tag) const noexcept
+    {
+        return get<Tag>();
+    }
+
+    template<
+        typename Tag,
+        typename... Args,
+        typename = detail::enable_if_t<
+            !detail::type_list_contains<Tag, dynamic_member_tags>::value>>
+    constexpr auto operator()(
+        detail::access_by_tag_tag, Tag, Args&&... args) const noexcept
+        -> decltype(std::declval<Message>()(
+            detail::access_by_tag_tag{}, Tag{}, std::forward<Args>(args)...))
+    {
+        return msg(
+            detail::access_by_tag_tag{}, Tag{}, std::forward<Args>(args)...);
+    }
+
+    constexpr auto operator()(detail::addressof_tag) const noexcept
+        -> decltype(sbepp::addressof(std::declval<Message>()))
+    {
+        return sbepp::addressof(msg);
+    }
+
+    constexpr auto operator()(detail::get_header_tag) const noexcept
+        -> decltype(sbepp::get_header(std::declval<Message>()))
+    {
+        return sbepp::get_header(msg);
+    }
+
+    SBEPP_CPP20_CONSTEXPR std::size_t
+        operator()(detail::size_bytes_tag) const noexcept
+    {
+        return size_bytes_impl(dynamic_member_tags{});
+    }
+    /// @endcond
+
+private:
+    Message msg;
+    offsets_type offsets{};
+
+    SBEPP_CPP14_CONSTEXPR void index_impl(type_list<>) noexcept
+    {
+    }
+
+    template<typename Tag, typename... Tags>
+    SBEPP_CPP20_CONSTEXPR void index_impl(type_list<Tag, Tags...> tags) noexcept
+    {
+        const auto first = sbepp::get_by_tag<Tag>(msg);
+        detail::index_dynamic_members(
+            msg,
+            offsets.data(),
+            static_cast<std::size_t>(
+                sbepp::addressof(first) - sbepp::addressof(msg)),
+            tags);
+    }
+
+    SBEPP_CPP20_CONSTEXPR std::size_t
+        size_bytes_impl(type_list<>) const noexcept
+    {
+        return sbepp::size_bytes(msg);
+    }
+
+    template<typename... Tags>
+    SBEPP_CPP20_CONSTEXPR std::size_t
+        size_bytes_impl(type_list<Tags...>) const noexcept
+    {
+        using last_tag =
+            typename detail::type_list_last<type_list<Tags...>>::type;
+        const auto last = get<last_tag>();
+        return offsets.back() + sbepp::size_bytes(last);
+    }
+};
+
+/**
+ * @brief Creates `sbepp::indexed_view` from a message view
+ *
+ * @param m message view, must not be empty
+ * @return indexed view
+ */
+template<typename Message>
+SBEPP_CPP20_CONSTEXPR indexed_view<Message>
+    make_indexed_view(const Message m) noexcept
+{
+    return indexed_view<Message>{m};
+}
+
+namespace detail
+{
+template<typename Byte>
+class top_level_offsets_recorder
+{
+public:
+    constexpr top_level_offsets_recorder(
+        Byte* base, std::size_t* offsets) noexcept
+        : base{base}, offsets{offsets}
+    {
+    }
+
+    SBEPP_CPP14_CONSTEXPR void
+        operator()(Byte* ptr, const std::size_t depth) noexcept
+    {
+        if(!depth)
+        {
+            *offsets = static_cast<std::size_t>(ptr - base);
+            offsets++;
+        }
+    }
+
+private:
+    Byte* base;
+    std::size_t* offsets;
+};
+} // namespace detail
+
+/**
+ * @brief Calculates message size with additional safety checks and indexes
+ *  it in the same pass
+ *
+ * Same as `size_bytes_checked(View, std::size_t)` but also collects offsets of
+ * group and data members during validation so there's no need to walk the
+ * message again to create `sbepp::indexed_view`.
+ *
+ * Example:
+ * ```cpp
+ * sbepp::indexed_view<decltype(m)> iv;
+ * if(sbepp::size_bytes_checked(m, size, iv).valid)
+ * {
+ *     // constant time access without re-walking the message
+ *     auto d = iv.get<schema::messages::msg::data>();
+ * }
+ * ```
+ *
+ * @param m message view
+ * @param size buffer size
+ * @param index receives indexed `m` if validation succeeds, unchanged
+ *  otherwise
+ */
+template<typename Message>
+SBEPP_CPP20_CONSTEXPR size_bytes_checked_result size_bytes_checked(
+    const Message m,
+    const std::size_t size,
+    indexed_view<Message>& index) noexcept
+{
+    typename indexed_view<Message>::offsets_type offsets{};
+    const auto res = detail::size_bytes_checked_impl(
+        m,
+        size,
+        detail::top_level_offsets_recorder<byte_type_t<Message>>{
+            sbepp::addressof(m), offsets.data()});
+    if(res.valid)
+    {
+        index = indexed_view<Message>{m, offsets};
+    }
+
+    return res;
+}
+
+namespace detail
+{
+template<typename Storage>
+using enable_if_offsets_storage_t = enable_if_t<std::is_same<
+    decltype(std::declval<Storage&>().data()),
+    std::size_t*>::value>;
+
+template<typename Group>
+using group_block_length_t = typename std::decay<decltype(sbepp::get_header(
+    std::declval<Group>())
+                                                              .blockLength()
+                                                              .value())>::type;
+} // namespace detail
+
+/**
+ * @brief Storage which is enough to index any `Group` object,
+ *  `std::array<std::size_t, Group::max_size()>`. Its size depends on
+ *  `numInGroup`'s `maxValue` so it's better to specify it in the schema
+ *  explicitly.
+ *
+ * @tparam Group nested group view type
+ *
+ * @warning With the default `uint16` `numInGroup` it holds 65534 offsets,
+ *  ~512KiB, so it's not suitable for the stack. Prefer a buffer sized from
+ *  the actual `Group::size()`, e.g. `std::vector<std::size_t>`.
+ */
+template<typename Group>
+using indexed_group_storage = std::array<std::size_t, Group::max_size()>;
+
+/**
+ * @brief Random access adapter over a nested group
+ *
+ * Nested group entries have different sizes so `nested_group_base` provides
+ * only forward iteration and getting `k`-th entry requires walking all the
+ * preceding ones. `indexed_group` walks the group once, on the first indexed
+ * access, and stores the offset of each entry in a caller-supplied buffer.
+ * After that, entries are accessible in constant time and iterators satisfy
+ * `std::random_access_iterator`.
+ *
+ * Example:
+ * ```cpp
+ * std::vector<std::size_t> storage(msg.levels().size());
+ * auto levels = sbepp::make_indexed_group(msg.levels(), storage);
+ * auto level = levels[k];
+ * ```
+ *
+ * @tparam Group nested group view type
+ *
+ * @note Only the first `capacity()` entries are indexed. If the group has
+ *  more entries, `size()` is clamped to `capacity()` and the rest of them
+ *  are not accessible, `reindex()` returns `false` in that case.
+ * @warning Offsets are not updated automatically, any change of group size
+ *  or of its entries sizes invalidates them. Call `reindex()` after such a
+ *  change.
+ * @note Index is built lazily by `const` member functions so sharing an
+ *  object between threads requires calling `reindex()` first.
+ */
+template<typename Group>
+class indexed_group
+{
+public:
+    static_assert(
+        is_nested_group<Group>::value,
+        "indexed_group requires a nested group view");
+
+    //! @brief Underlying group view type
+    using group_type = Group;
+    //! @brief Entry type
+    using value_type = typename Group::value_type;
+    //! @brief `value_type`
+    using reference = value_type;
+    //! @brief Raw size type
+    using size_type = typename Group::size_type;
+    //! @brief Signed `size_type`
+    using difference_type = typename Group::difference_type;
+
+    //! @brief Random access iterator to `value_type`. Satisfies
+    //!     `std::random_access_iterator`
+    using iterator = detail::offset_table_iterator<
+        byte_type_t<Group>,
+        value_type,
+        detail::group_block_length_t<Group>,
+        difference_type,
+        size_type>;
+
+    //! @brief Constructs an empty object which can only be assigned to
+    indexed_group() = default;
+
+    /**
+     * @brief Constructs from a group view and offsets buffer
+     *
+     * @param g group view, must not be empty
+     * @param offsets buffer for entry offsets
+     * @param capacity `offsets` size, at most `capacity` entries are
+     *  accessible
+     */
+    constexpr indexed_group(
+        const Group g,
+        std::size_t* offsets,
+        const std::size_t capacity) noexcept
+        : g{g}, offsets{offsets}, offsets_capacity{capacity}
+    {
+    }
+
+    /**
+     * @brief Constructs from a group view and contiguous offsets storage
+     *
+     * @param g group view, must not be empty
+     * @param offsets storage with `data()` and `size()`, e.g. `std::array` or
+     *  `std::vector` of `std::size_t`
+     */
+    template<
+        typename Storage,
+        typename = detail::enable_if_offsets_storage_t<Storage>>
+    constexpr indexed_group(const Group g, Storage& offsets) noexcept
+        : indexed_group{g, offsets.data(), offsets.size()}
+    {
+    }
+
+    //! @brief Returns underlying group view
+    constexpr Group group() const noexcept
+    {
+        return g;
+    }
+
+    //! @brief Returns offsets buffer size
+    constexpr std::size_t capacity() const noexcept
+    {
+        return offsets_capacity;
+    }
+
+    //! @brief Returns number of accessible entries,
+    //!     `min(group().size(), capacity())`
+    SBEPP_CPP20_CONSTEXPR size_type size() const noexcept
+    {
+        return static_cast<size_type>(
+            std::min(static_cast<std::size_t>(g.size()), capacity()));
+    }
+
+    //! @brief Checks if `size() == 0`
+    SBEPP_CPP17_NODISCARD SBEPP_CPP20_CONSTEXPR bool empty() const noexcept
+    {
+        return !size();
+    }
+
+    //! @brief Checks if index is built
+    constexpr bool is_indexed() const noexcept
+    {
+        return indexed;
+    }
+
+    /**
+     * @brief (Re)builds the index. Must be called after a change of group
+     *  size or of its entries sizes.
+     *
+     * @return `true` if all group entries are indexed, `false` if
+     *  `group().size() > capacity()`, in that case only the first
+     *  `capacity()` entries are indexed
+     */
+    SBEPP_CPP20_CONSTEXPR bool reindex() const noexcept
+    {
+        SBEPP_ASSERT(sbepp::addressof(g));
+        const std::size_t count = size();
+        std::size_t i{};
+        for(auto it = g.begin(); i != count; ++it, i++)
+        {
+            offsets[i] = static_cast<std::size_t>(
+                sbepp::addressof(*it) - sbepp::addressof(g));
+        }
+        indexed = true;
+        return is_complete();
+    }
+
+    //! @brief Returns an iterator to the beginning, builds index if needed
+    SBEPP_CPP20_CONSTEXPR iterator begin() const noexcept
+    {
+        return make_iterator(0);
+    }
+
+    //! @brief Returns an iterator to the end, builds index if needed
+    SBEPP_CPP20_CONSTEXPR iterator end() const noexcept
+    {
+        return make_iterator(size());
+    }
+
+    //! @brief Access group entry at `pos`, builds index if needed
+    //! @pre `pos < size()`
+    SBEPP_CPP20_CONSTEXPR reference operator[](size_type pos) const noexcept
+    {
+        SBEPP_ASSERT(pos < size());
+        return *make_iterator(pos);
+    }
+
+    //! @brief Returns the first element
+    //! @pre `!empty()`
+    SBEPP_CPP20_CONSTEXPR reference front() const noexcept
+    {
+        SBEPP_ASSERT(!empty());
+        return (*this)[0];
+    }
+
+    //! @brief Returns the last element
+    //! @pre `!empty()`
+    SBEPP_CPP20_CONSTEXPR reference back() const noexcept
+    {
+        SBEPP_ASSERT(!empty());
+        return (*this)[size() - 1];
+    }
+
+    /// @cond INTERNAL
+    constexpr byte_type_t<Group>*
+        operator()(detail::addressof_tag) const noexcept
+    {
+        return sbepp::addressof(g);
+    }
+
+    constexpr auto operator()(detail::get_header_tag) const noexcept
+        -> decltype(sbepp::get_header(std::declval<Group>()))
+    {
+        return sbepp::get_header(g);
+    }
+
+    SBEPP_CPP20_CONSTEXPR std::size_t
+        operator()(detail::size_bytes_tag) const noexcept
+    {
+        if(!is_complete())
+        {
+            return sbepp::size_bytes(g);
+        }
+        if(empty())
+        {
+            return sbepp::size_bytes(sbepp::get_header(g));
+        }
+        const auto last = back();
+        return static_cast<std::size_t>(
+            sbepp::addressof(last) - sbepp::addressof(g)
+            + sbepp::size_bytes(last));
+    }
+    /// @endcond
+
+private:
+    Group g;
+    std::size_t* offsets{};
+    std::size_t offsets_capacity{};
+    mutable bool indexed{};
+
+    SBEPP_CPP20_CONSTEXPR bool is_complete() const noexcept
+    {
+        return g.size() <= capacity();
+    }
+
+    SBEPP_CPP20_CONSTEXPR iterator
+        make_iterator(const size_type index) const noexcept
+    {
+        if(!indexed)
+        {
+            reindex();
+        }
+
+        return iterator{
+            sbepp::addressof(g),
+            offsets,
+            sbepp::get_header(g).blockLength().value(),
+            index,
+            g(detail::end_ptr_tag{})};
+    }
+};
+
+/**
+ * @brief Creates `sbepp::indexed_group` from a nested group view and offsets
+ *  buffer
+ *
+ * @param g nested group view
+ * @param offsets buffer for entry offsets
+ * @param capacity `offsets` size
+ * @return indexed group
+ */
+template<typename Group>
+constexpr indexed_group<Group> make_indexed_group(
+    const Group g, std::size_t* offsets, const std::size_t capacity) noexcept
+{
+    return {g, offsets, capacity};
+}
+
+/**
+ * @brief Creates `sbepp::indexed_group` from a nested group view and
+ *  contiguous offsets storage
+ *
+ * @param g nested group view
+ * @param offsets storage for entry offsets with `data()` and `size()`, e.g.
+ *  `std::array` or `std::vector` of `std::size_t`
+ * @return indexed group
+ */
+template<
+    typename Group,
+    typename Storage,
+    typename = detail::enable_if_offsets_storage_t<Storage>>
+constexpr indexed_group<Group>
+    make_indexed_group(const Group g, Storage& offsets) noexcept
+{
+    return {g, offsets};
+}
+
+namespace detail
+{
+template<typename T, typename = void>
+struct column_value
+{
+    using type = T;
+
+    static constexpr type get(const T value) noexcept
+    {
+        return value;
+    }
+};
+
+// required and optional types are stored as their underlying values
+template<typename T>
+struct column_value<
+    T,
+    enable_if_t<is_required_type<T>::value || is_optional_type<T>::value>>
+{
+    using type = typename T::value_type;
+
+    static constexpr type get(const T value) noexcept
+    {
+        return value.value();
+    }
+};
+
+// flat group entries are placed at fixed stride, each entry view is
+// constructed directly from its offset and shares the group's end pointer
+template<typename Group>
+class flat_group_entries
+{
+public:
+    using entry_type = typename Group::value_type;
+    using byte_type = typename std::remove_pointer<decltype(sbepp::addressof(
+        std::declval<Group>()))>::type;
+
+    explicit SBEPP_CPP20_CONSTEXPR flat_group_entries(const Group g) noexcept
+    {
+        static_assert(
+            is_flat_group<Group>::value, "only flat groups are supported");
+        const auto header = g(get_header_tag{});
+        count = header.numInGroup().value();
+        block_length = header.blockLength().value();
+        first = sbepp::addressof(g) + sbepp::size_bytes(header);
+        end = g(end_ptr_tag{});
+        SBEPP_SIZE_CHECK(sbepp::addressof(g), end, 0, sbepp::size_bytes(g));
+    }
+
+    constexpr std::size_t size() const noexcept
+    {
+        return count;
+    }
+
+    constexpr entry_type operator[](const std::size_t index) const noexcept
+    {
+        return entry_type{first + index * block_length, end, block_length};
+    }
+
+private:
+    byte_type* first{};
+    byte_type* end{};
+    std::size_t count{};
+    group_block_length_t<Group> block_length{};
+};
+} // namespace detail
+
+/**
+ * @brief Native value type of `sbepp::extract_column()` output for the field
+ *  `FieldTag`. Underlying type for required and optional types, field type
+ *  itself otherwise
+ */
+template<typename FieldTag>
+using column_value_t = typename detail::column_value<
+    typename field_traits<FieldTag>::value_type>::type;
+
+/**
+ * @brief Copies field values of all flat group entries into a contiguous
+ *  array
+ *
+ * Values are converted to native endianness. Entries are accessed at fixed
+ * `blockLength` stride without constructing iterators, which lets compiler
+ * vectorize the loop.
+ *
+ * Example:
+ * ```cpp
+ * using field_tag = market::schema::messages::msg::group::field;
+ * std::vector<sbepp::column_value_t<field_tag>> fields(g.size());
+ * sbepp::extract_column<field_tag>(g, fields.data(), fields.size());
+ * ```
+ *
+ * @tparam FieldTag group field tag
+ * @param g flat group
+ * @param out output array
+ * @param out_size `out` size
+ * @return number of copied values, `min(g.size(), out_size)`
+ */
+template<typename FieldTag, typename Group>
+SBEPP_CPP20_CONSTEXPR std::size_t extract_column(
+    const Group g,
+    column_value_t<FieldTag>* out,
+    const std::size_t out_size) noexcept
+{
+    using column_value = detail::column_value<
+        typename field_traits<FieldTag>::value_type>;
+    const detail::flat_group_entries<Group> entries{g};
+    const auto size = std::min(entries.size(), out_size);
+    for(std::size_t i = 0; i != size; i++)
+    {
+        out[i] = column_value::get(sbepp::get_by_tag<FieldTag>(entries[i]));
+    }
+    return size;
+}
+
+namespace detail
+{
+template<typename Entry>
+SBEPP_CPP14_CONSTEXPR void
+    extract_fields(const Entry, const std::size_t, type_list<>) noexcept
+{
+}
+
+template<
+    typename Entry,
+    typename FieldTag,
+    typename... FieldTags,
+    typename T,
+    typename... Ts>
+SBEPP_CPP20_CONSTEXPR void extract_fields(
+    const Entry entry,
+    const std::size_t index,
+    type_list<FieldTag, FieldTags...>,
+    T* out,
+    Ts*... outs) noexcept
+{
+    out[index] = column_value<typename field_traits<FieldTag>::value_type>::
+        get(sbepp::get_by_tag<FieldTag>(entry));
+    extract_fields(entry, index, type_list<FieldTags...>{}, outs...);
+}
+} // namespace detail
+
+/**
+ * @brief Multi-field version of `sbepp::extract_column()`, copies values of
+ *  several fields in a single pass over entries
+ *
+ * Example:
+ * ```cpp
+ * sbepp::extract_columns<price_tag, quantity_tag>(
+ *     g, size, prices.data(), quantities.data());
+ * ```
+ *
+ * @tparam FieldTags group field tags
+ * @param g flat group
+ * @param out_size size of each output array
+ * @param outs output arrays, one for each tag in `FieldTags`
+ * @return number of copied entries, `min(g.size(), out_size)`
+ */
+template<typename... FieldTags, typename Group>
+SBEPP_CPP20_CONSTEXPR std::size_t extract_columns(
+    const Group g,
+    const std::size_t out_size,
+    column_value_t<FieldTags>*... outs) noexcept
+{
+    const detail::flat_group_entries<Group> entries{g};
+    const auto size = std::min(entries.size(), out_size);
+    for(std::size_t i = 0; i != size; i++)
+    {
+        detail::extract_fields(
+            entries[i], i, type_list<FieldTags...>{}, outs...);
+    }
+    return size;
+}
+
+namespace detail
+{
+template<typename T, bool = is_optional_type<T>::value>
+struct column_null_check
+{
+    static constexpr bool is_null(const T) noexcept
+    {
+        return false;
+    }
+};
+
+// optional fields skip null values
+template<typename T>
+struct column_null_check<T, true>
+{
+    static constexpr bool is_null(const T value) noexcept
+    {
+        return !value.has_value();
+    }
+};
+
+template<typename T>
+using column_sum_type = typename std::conditional<
+    std::is_floating_point<T>::value,
+    double,
+    typename std::conditional<
+        std::is_signed<T>::value,
+        std::int64_t,
+        std::uint64_t>::type>::type;
+
+template<typename T>
+struct column_best
+{
+    // `entries.size()` if there are no non-null values
+    std::size_t index;
+    T value;
+};
+
+// finds the first non-null value which satisfies `compare(value, best)` for
+// all other values
+template<typename FieldTag, typename Group, typename Compare>
+SBEPP_CPP20_CONSTEXPR column_best<column_value_t<FieldTag>>
+    column_find_best(const Group g, Compare compare) noexcept
+{
+    using value_type = typename field_traits<FieldTag>::value_type;
+    using column = column_value<value_type>;
+    static_assert(
+        std::is_arithmetic<typename column::type>::value,
+        "field should have arithmetic type");
+    const flat_group_entries<Group> entries{g};
+    column_best<typename column::type> best{entries.size(), {}};
+    for(std::size_t i = 0; i != entries.size(); i++)
+    {
+        const auto value = sbepp::get_by_tag<FieldTag>(entries[i]);
+        const auto native = column::get(value);
+        // no data-dependent control flow in the source, compiler is still
+        // free to turn selects into branches
+        const bool has_value = !column_null_check<value_type>::is_null(value);
+        const bool is_first = (best.index == entries.size());
+        const bool is_better = compare(native, best.value);
+        const bool take = has_value & (is_first | is_better);
+        best.value = take ? native : best.value;
+        best.index = take ? i : best.index;
+    }
+    return best;
+}
+
+struct column_less
+{
+    template<typename T>
+    constexpr bool operator()(const T lhs, const T rhs) const noexcept
+    {
+        return lhs < rhs;
+    }
+};
+
+struct column_greater
+{
+    template<typename T>
+    constexpr bool operator()(const T lhs, const T rhs) const noexcept
+    {
+        return lhs > rhs;
+    }
+};
+} // namespace detail
+
+//! @brief Result type of `sbepp::column_sum()`, `double` for floating point
+//!     fields, `std::int64_t` or `std::uint64_t` for integral ones
+template<typename FieldTag>
+using column_sum_t = detail::column_sum_type<column_value_t<FieldTag>>;
+
+/**
+ * @brief Returns sum of field values of all flat group entries
+ *
+ * Null values of optional fields are skipped. Like `sbepp::extract_column()`,
+ * entries are accessed at fixed stride without constructing iterators.
+ *
+ * @tparam FieldTag group field tag of arithmetic type
+ * @param g flat group
+ */
+template<typename FieldTag, typename Group>
+SBEPP_CPP20_CONSTEXPR column_sum_t<FieldTag> column_sum(const Group g) noexcept
+{
+    using value_type = typename field_traits<FieldTag>::value_type;
+    using column = detail::column_value<value_type>;
+    static_assert(
+        std::is_arithmetic<typename column::type>::value,
+        "field should have arithmetic type");
+    const detail::flat_group_entries<Group> entries{g};
+    column_sum_t<FieldTag> sum{};
+    for(std::size_t i = 0; i != entries.size(); i++)
+    {
+        const auto value = sbepp::get_by_tag<FieldTag>(entries[i]);
+        // branchless to let compiler vectorize the loop
+        sum += detail::column_null_check<value_type>::is_null(value)
+                   ? column_sum_t<FieldTag>{}
+                   : static_cast<column_sum_t<FieldTag>>(column::get(value));
+    }
+    return sum;
+}
+
+/**
+ * @brief Returns index of the first entry with the minimum field value
+ *
+ * @tparam FieldTag group field tag of arithmetic type
+ * @param g flat group
+ * @return entry index or `g.size()` if there are no non-null values
+ */
+template<typename FieldTag, typename Group>
+SBEPP_CPP20_CONSTEXPR std::size_t column_argmin(const Group g) noexcept
+{
+    return detail::column_find_best<FieldTag>(g, detail::column_less{})
+        .index;
+}
+
+/**
+ * @brief Returns index of the first entry with the maximum field value
+ *
+ * @tparam FieldTag group field tag of arithmetic type
+ * @param g flat group
+ * @return entry index or `g.size()` if there are no non-null values
+ */
+template<typename FieldTag, typename Group>
+SBEPP_CPP20_CONSTEXPR std::size_t column_argmax(const Group g) noexcept
+{
+    return detail::column_find_best<FieldTag>(g, detail::column_greater{})
+        .index;
+}
+
+/**
+ * @brief Returns the minimum field value
+ *
+ * @tparam FieldTag group field tag of arithmetic type
+ * @param g flat group
+ * @pre group contains at least one non-null value
+ */
+template<typename FieldTag, typename Group>
+SBEPP_CPP20_CONSTEXPR column_value_t<FieldTag>
+    column_min(const Group g) noexcept
+{
+    const auto best =
+        detail::column_find_best<FieldTag>(g, detail::column_less{});
+    SBEPP_ASSERT(best.index != g.size());
+    return best.value;
+}
+
+/**
+ * @brief Returns the maximum field value
+ *
+ * @tparam FieldTag group field tag of arithmetic type
+ * @param g flat group
+ * @pre group contains at least one non-null value
+ */
+template<typename FieldTag, typename Group>
+SBEPP_CPP20_CONSTEXPR column_value_t<FieldTag>
+    column_max(const Group g) noexcept
+{
+    const auto best =
+        detail::column_find_best<FieldTag>(g, detail::column_greater{});
+    SBEPP_ASSERT(best.index != g.size());
+    return best.value;
+}
+
+/**
+ * @brief Returns number of entries whose field value is null
+ *
+ * @tparam FieldTag group field tag of optional type
+ * @param g flat group
+ */
+template<typename FieldTag, typename Group>
+SBEPP_CPP20_CONSTEXPR std::size_t column_count_null(const Group g) noexcept
+{
+    using value_type = typename field_traits<FieldTag>::value_type;
+    static_assert(
+        is_optional_type<value_type>::value, "field should be optional");
+    const detail::flat_group_entries<Group> entries{g};
+    std::size_t count{};
+    for(std::size_t i = 0; i != entries.size(); i++)
+    {
+        count += !sbepp::get_by_tag<FieldTag>(entries[i]).has_value();
+    }
+    return count;
+}
+
+/**
+ * @brief Writes indexes of entries whose field value satisfies `pred`
+ *
+ * Null values of optional fields are skipped. Example:
+ * ```cpp
+ * std::array<std::size_t, 32> indexes;
+ * const auto count = sbepp::column_filter<group_tag::field>(
+ *     g,
+ *     [](const std::uint32_t value) { return value > 10; },
+ *     indexes.data(),
+ *     indexes.size());
+ * ```
+ *
+ * @tparam FieldTag group field tag
+ * @param g flat group
+ * @param pred predicate which takes `sbepp::column_value_t<FieldTag>`
+ * @param out output array of indexes
+ * @param out_size `out` size
+ * @return number of written indexes, stops when `out` is full
+ */
+template<typename FieldTag, typename Group, typename Predicate>
+SBEPP_CPP20_CONSTEXPR std::size_t column_filter(
+    const Group g,
+    Predicate&& pred,
+    std::size_t* out,
+    const std::size_t out_size)
+{
+    using value_type = typename field_traits<FieldTag>::value_type;
+    using column = detail::column_value<value_type>;
+    const detail::flat_group_entries<Group> entries{g};
+    std::size_t count{};
+    for(std::size_t i = 0; (i != entries.size()) && (count != out_size); i++)
+    {
+        const auto value = sbepp::get_by_tag<FieldTag>(entries[i]);
+        out[count] = i;
+        count += !detail::column_null_check<value_type>::is_null(value)
+                 && pred(column::get(value));
+    }
+    return count;
+}
+
+//! @brief Error code of non-asserting accessors
+enum class access_error
+{
+    //! view is constructed from `nullptr`
+    null_view,
+    //! requested member doesn't fit into the buffer
+    out_of_bounds
+};
+
+/**
+ * @brief Minimal `std::expected`-like type, holds either a value or
+ *  `sbepp::access_error`
+ *
+ * @tparam T value type
+ */
+template<typename T>
+class access_result
+{
+public:
+    //! @brief Value type
+    using value_type = T;
+
+    //! @brief Constructs from a value
+    // NOLINTNEXTLINE: implicit conversion is intentional
+    constexpr access_result(const T value) noexcept : val{value}, ok{true}
+    {
+    }
+
+    //! @brief Constructs from an error
+    // NOLINTNEXTLINE: implicit conversion is intentional
+    constexpr access_result(const access_error error) noexcept : err{error}
+    {
+    }
+
+    //! @brief Checks if there's a value
+    constexpr bool has_value() const noexcept
+    {
+        return ok;
+    }
+
+    //! @brief Same as `has_value()`
+    constexpr explicit operator bool() const noexcept
+    {
+        return has_value();
+    }
+
+    /**
+     * @brief Returns the value
+     *
+     * @pre `has_value() == true`
+     */
+    SBEPP_CPP14_CONSTEXPR T value() const noexcept
+    {
+        SBEPP_ASSERT(has_value());
+        return val;
+    }
+
+    //! @brief Same as `value()`
+    SBEPP_CPP14_CONSTEXPR T operator*() const noexcept
+    {
+        return value();
+    }
+
+    /**
+     * @brief Provides access to the value's members
+     *
+     * @pre `has_value() == true`
+     */
+    SBEPP_CPP14_CONSTEXPR const T* operator->() const noexcept
+    {
+        SBEPP_ASSERT(has_value());
+        return &val;
+    }
+
+    //! @brief Returns the value if there's one, `default_value` otherwise
+    constexpr T value_or(const T default_value) const noexcept
+    {
+        return has_value() ? val : default_value;
+    }
+
+    /**
+     * @brief Returns the error
+     *
+     * @pre `has_value() == false`
+     */
+    SBEPP_CPP14_CONSTEXPR access_error error() const noexcept
+    {
+        SBEPP_ASSERT(!has_value());
+        return err;
+    }
+
+private:
+    T val{};
+    access_error err{};
+    bool ok{};
+};
+
+template<typename View>
+class checked_view;
+
+namespace detail
+{
+template<typename View, bool = is_message<View>::value>
+struct level_traits
+{
+    using type = message_traits<traits_tag_t<View>>;
+};
+
+template<typename View>
+struct level_traits<View, false>
+{
+    using type = group_traits<traits_tag_t<View>>;
+};
+
+template<typename View>
+using level_traits_t = typename level_traits<View>::type;
+
+template<typename Byte>
+constexpr std::size_t available_size(Byte* ptr, Byte* end) noexcept
+{
+    return (ptr <= end) ? static_cast<std::size_t>(end - ptr) : 0;
+}
+
+// checks that the level's block fits into the buffer. Both actual and schema
+// block lengths are taken into account so after that all fixed fields of the
+// level can be accessed without further checks. For messages, header should be
+// validated first.
+template<typename View, typename Byte>
+SBEPP_CPP14_CONSTEXPR bool block_fits(const View view, Byte* end) noexcept
+{
+    const std::size_t actual_block_length = view(get_block_length_tag{});
+    const std::size_t schema_block_length =
+        level_traits_t<View>::block_length();
+    const std::size_t block_length =
+        (actual_block_length < schema_block_length) ? schema_block_length
+                                                    : actual_block_length;
+    return block_length <= available_size(view(get_level_tag{}), end);
+}
+
+// returns pointer past the end of the group or `nullptr` if it doesn't fit
+template<
+    typename Group,
+    typename Byte,
+    typename = enable_if_t<is_group<Group>::value>>
+SBEPP_CPP20_CONSTEXPR Byte*
+    checked_member_end(const Group g, Byte* end) noexcept
+{
+    const auto res = sbepp::size_bytes_checked(
+        g, available_size(sbepp::addressof(g), end));
+    return res.valid ? (sbepp::addressof(g) + res.size) : nullptr;
+}
+
+// returns pointer past the end of the data or `nullptr` if it doesn't fit
+template<
+    typename Data,
+    typename Byte,
+    typename = enable_if_t<!is_group<Data>::value>,
+    typename = int>
+SBEPP_CPP14_CONSTEXPR Byte* checked_member_end(const Data d, Byte* end) noexcept
+{
+    const auto available = available_size(sbepp::addressof(d), end);
+    // length prefix should be checked before `size_bytes()` reads it
+    if((available < sizeof(typename Data::size_type))
+       || (available < sbepp::size_bytes(d)))
+    {
+        return nullptr;
+    }
+    return sbepp::addressof(d) + sbepp::size_bytes(d);
+}
+
+template<typename Tag, typename View, typename Byte, typename... Tags>
+SBEPP_CPP20_CONSTEXPR Byte* find_member_checked(
+    View view, Byte* ptr, Byte* end, type_list<Tags...>) noexcept;
+
+template<typename Tag, typename View, typename Byte, typename... Tags>
+constexpr Byte* find_member_checked_impl(
+    View, Byte* ptr, Byte*, std::true_type, type_list<Tags...>) noexcept
+{
+    return ptr;
+}
+
+template<
+    typename Tag,
+    typename View,
+    typename Byte,
+    typename Current,
+    typename... Tags>
+SBEPP_CPP20_CONSTEXPR Byte* find_member_checked_impl(
+    const View view,
+    Byte* ptr,
+    Byte* end,
+    std::false_type,
+    type_list<Current, Tags...>) noexcept
+{
+    using member_type = decltype(sbepp::get_by_tag<Current>(view));
+    // validation doesn't rely on size checks, unchecked view is used to avoid
+    // assertions on malformed input
+    const auto next = checked_member_end(
+        member_type{ptr, static_cast<Byte*>(nullptr)}, end);
+    if(!next)
+    {
+        return nullptr;
+    }
+    return find_member_checked<Tag>(view, next, end, type_list<Tags...>{});
+}
+
+// returns pointer to `Tag` member, `nullptr` if one of the preceding members
+// doesn't fit into the buffer
+template<typename Tag, typename View, typename Byte, typename... Tags>
+SBEPP_CPP20_CONSTEXPR Byte* find_member_checked(
+    const View view, Byte* ptr, Byte* end, type_list<Tags...> tags) noexcept
+{
+    return find_member_checked_impl<Tag>(
+        view,
+        ptr,
+        end,
+        std::is_same<Tag, typename type_list_first<type_list<Tags...>>::type>{},
+        tags);
+}
+
+template<typename View, typename Byte>
+SBEPP_CPP14_CONSTEXPR access_result<checked_view<View>>
+    make_checked_level(const View view, Byte* end) noexcept
+{
+    if(!block_fits(view, end))
+    {
+        return access_error::out_of_bounds;
+    }
+    return checked_view<View>{view, end};
+}
+
+template<
+    typename Group,
+    typename Byte,
+    typename = enable_if_t<is_group<Group>::value>>
+SBEPP_CPP14_CONSTEXPR access_result<checked_view<Group>>
+    make_checked_member(const Group g, Byte* end) noexcept
+{
+    if(available_size(sbepp::addressof(g), end) < unchecked_header_size(g))
+    {
+        return access_error::out_of_bounds;
+    }
+    return checked_view<Group>{g, end};
+}
+
+template<
+    typename Data,
+    typename Byte,
+    typename = enable_if_t<!is_group<Data>::value>,
+    typename = int>
+SBEPP_CPP14_CONSTEXPR access_result<Data>
+    make_checked_member(const Data d, Byte* end) noexcept
+{
+    if(!checked_member_end(d, end))
+    {
+        return access_error::out_of_bounds;
+    }
+    return d;
+}
+
+template<typename View, typename Tag>
+using checked_member_t = decltype(make_checked_member(
+    sbepp::get_by_tag<Tag>(std::declval<View>()),
+    std::declval<byte_type_t<View>*>()));
+
+// returns pointer past the end of the entry or `nullptr` if it doesn't fit
+template<typename Entry, typename Byte>
+SBEPP_CPP20_CONSTEXPR Byte* checked_entry_end(
+    const Entry e, const std::size_t block_length, Byte* end) noexcept
+{
+    const auto size = available_size(sbepp::addressof(e), end);
+    size_bytes_checked_visitor<null_offset_recorder> visitor{size, {}};
+    visitor.set_group_block_length(block_length);
+    cursor<Byte> c;
+    c.pointer() = sbepp::addressof(e);
+    if(visitor.on_entry(e, c))
+    {
+        return nullptr;
+    }
+    return sbepp::addressof(e) + (size - visitor.get_size());
+}
+} // namespace detail
+
+/**
+ * @brief Non-asserting wrapper over a message, group or entry view for
+ *  untrusted input
+ *
+ * Unlike normal views, it always knows the end of the underlying buffer and
+ * never relies on `SBEPP_SIZE_CHECK`. Message and entry blocks are validated
+ * once, when `checked_view` is created, so their fields can be accessed
+ * directly via `operator->()` without per-field checks. Group and data members
+ * are accessible only through `try_get()` which validates preceding dynamic
+ * members on the way. Similarly, group entries are accessible via `try_at()`.
+ * Example:
+ *
+ * ```cpp
+ * auto res = sbepp::try_make_view<market::messages::msg>(ptr, size);
+ * if(!res)
+ * {
+ *     return; // malformed packet
+ * }
+ * auto price = res.value()->price(); // no checks here
+ * auto levels = res->try_get<market::schema::messages::msg::levels>();
+ * if(levels)
+ * {
+ *     for(std::size_t i = 0; i != levels->size(); i++)
+ *     {
+ *         auto entry = levels->try_at(i);
+ *     }
+ * }
+ * ```
+ *
+ * @tparam View message, group or entry view
+ */
+template<typename View>
+class checked_view
+{
+public:
+    //! @brief Underlying view type
+    using view_type = View;
+    //! @brief Byte type
+    using byte_type = sbepp::byte_type_t<View>;
+
+    //! @brief Constructs an object which doesn't refer to any buffer
+    checked_view() = default;
+
+    /**
+     * @brief Wraps a view. Doesn't perform any checks, normally
+     *  `sbepp::try_make_view()` should be used instead.
+     *
+     * @param view view to wrap
+     * @param end buffer end
+     */
+    constexpr checked_view(const View view, byte_type* end) noexcept
+        : v{view}, end{end}
+    {
+    }
+
+    //! @brief Returns underlying view
+    constexpr View view() const noexcept
+    {
+        return v;
+    }
+
+    //! @brief Provides access to underlying view's members
+    constexpr const View* operator->() const noexcept
+    {
+        return &v;
+    }
+
+    //! @brief Returns buffer end
+    constexpr byte_type* buffer_end() const noexcept
+    {
+        return end;
+    }
+
+    /**
+     * @brief Gets group or data member by tag
+     *
+     * Doesn't assert, instead, validates all preceding group and data members.
+     *
+     * @tparam Tag group or data tag
+     * @return `sbepp::checked_view` for a group (only its header is checked),
+     *  data view for data (checked entirely) or
+     *  `sbepp::access_error::out_of_bounds`
+     */
+    template<typename Tag>
+    SBEPP_CPP20_CONSTEXPR detail::checked_member_t<View, Tag>
+        try_get() const noexcept
+    {
+        using tags = typename detail::type_list_concat<
+            typename detail::level_traits_t<View>::group_tags,
+            typename detail::level_traits_t<View>::data_tags>::type;
+        static_assert(
+            detail::type_list_contains<Tag, tags>::value,
+            "Tag is not a group or data member of View");
+
+        auto ptr = detail::find_member_checked<Tag>(
+            v,
+            v(detail::get_level_tag{}) + v(detail::get_block_length_tag{}),
+            end,
+            tags{});
+        if(!ptr)
+        {
+            return access_error::out_of_bounds;
+        }
+
+        using member_type = decltype(sbepp::get_by_tag<Tag>(v));
+        return detail::make_checked_member(member_type{ptr, end}, end);
+    }
+
+    //! @brief Returns the number of group entries. Available only for groups.
+    template<typename V = View>
+    constexpr typename V::size_type size() const noexcept
+    {
+        return v.size();
+    }
+
+    /**
+     * @brief Gets group entry by index. Available only for groups.
+     *
+     * Doesn't assert, instead, validates that the entry block fits into the
+     * buffer. For nested groups, all preceding entries are validated too.
+     *
+     * @param index entry index
+     * @return `sbepp::checked_view` for the entry or
+     *  `sbepp::access_error::out_of_bounds`
+     */
+    template<typename V = View>
+    SBEPP_CPP20_CONSTEXPR access_result<checked_view<typename V::value_type>>
+        try_at(const std::size_t index) const noexcept
+    {
+        if(index >= v.size())
+        {
+            return access_error::out_of_bounds;
+        }
+        return try_at_impl(index, is_flat_group<V>{});
+    }
+
+private:
+    View v;
+    byte_type* end{};
+
+    template<typename V = View>
+    SBEPP_CPP14_CONSTEXPR access_result<checked_view<typename V::value_type>>
+        try_at_impl(const std::size_t index, std::true_type) const noexcept
+    {
+        const std::size_t block_length =
+            *sbepp::get_header(v).blockLength();
+        // don't form the pointer if it's past the end
+        if((block_length != 0)
+           && (index
+               >= (detail::available_size(sbepp::addressof(v), end)
+                   - detail::get_header_size(v))
+                      / block_length))
+        {
+            return access_error::out_of_bounds;
+        }
+
+        return detail::make_checked_level(
+            typename V::value_type{
+                sbepp::addressof(v) + detail::get_header_size(v)
+                    + index * block_length,
+                end,
+                *sbepp::get_header(v).blockLength()},
+            end);
+    }
+
+    template<typename V = View>
+    SBEPP_CPP20_CONSTEXPR access_result<checked_view<typename V::value_type>>
+        try_at_impl(const std::size_t index, std::false_type) const noexcept
+    {
+        const auto block_length = *sbepp::get_header(v).blockLength();
+        auto ptr = sbepp::addressof(v) + detail::get_header_size(v);
+        for(std::size_t i = 0; i != index; i++)
+        {
+            // see `detail::find_member_checked_impl()`
+            ptr = detail::checked_entry_end(
+                typename V::value_type{
+                    ptr, static_cast<byte_type*>(nullptr), block_length},
+                block_length,
+                end);
+            if(!ptr)
+            {
+                return access_error::out_of_bounds;
+            }
+        }
+
+        return detail::make_checked_level(
+            typename V::value_type{ptr, end, block_length}, end);
+    }
+};
+
+/**
+ * @brief Non-asserting version of `sbepp::make_view()` for untrusted input
+ *
+ * Checks that `ptr` is not `nullptr`, and message header and block fit into
+ * the buffer.
+ *
+ * @tparam View message view template
+ * @tparam Byte byte type
+ * @param ptr buffer start
+ * @param size buffer size
+ * @return `sbepp::checked_view` of the message or the error
+ */
+template<template<typename> class View, typename Byte>
+SBEPP_CPP14_CONSTEXPR access_result<checked_view<View<Byte>>>
+    try_make_view(Byte* ptr, const std::size_t size) noexcept
+{
+    if(!ptr)
+    {
+        return access_error::null_view;
+    }
+
+    const View<Byte> m{ptr, size};
+    if(size < detail::unchecked_header_size(m))
+    {
+        return access_error::out_of_bounds;
+    }
+    return detail::make_checked_level(m, ptr + size);
+}
+
+/**
+ * @brief Non-asserting version of `sbepp::make_const_view()` for untrusted
+ *  input
+ *
+ * @tparam View message view template
+ * @tparam Byte byte type
+ * @param ptr buffer start
+ * @param size buffer size
+ * @return `sbepp::checked_view` of the message or the error
+ */
+template<template<typename> class View, typename Byte>
+SBEPP_CPP14_CONSTEXPR
+    access_result<checked_view<View<typename std::add_const<Byte>::type>>>
+    try_make_const_view(Byte* ptr, const std::size_t size) noexcept
+{
+    return sbepp::try_make_view<View>(
+        static_cast<typename std::add_const<Byte>::type*>(ptr), size);
+}
+
+//! @brief Simple Open Framing Header (SOFH) encoding type
+enum class sofh_encoding : std::uint16_t
+{
+    //! SBE version 1.0, big-endian
+    sbe_big_endian = 0x5BE0,
+    //! SBE version 1.0, little-endian
+    sbe_little_endian = 0xEB50
+};
+
+//! @brief Simple Open Framing Header (SOFH)
+struct sofh_header
+{
+    //! Frame length, includes the header itself
+    std::uint32_t message_length;
+    //! Encoding type
+    sofh_encoding encoding;
+};
+
+//! @brief Returns encoded SOFH size
+constexpr std::size_t sofh_size() noexcept
+{
+    return sizeof(std::uint32_t) + sizeof(std::uint16_t);
+}
+
+/**
+ * @brief Returns SOFH encoding type for the given schema
+ *
+ * @tparam SchemaTag schema tag
+ */
+template<typename SchemaTag>
+constexpr sofh_encoding sofh_schema_encoding() noexcept
+{
+    return (schema_traits<SchemaTag>::byte_order() == endian::big)
+               ? sofh_encoding::sbe_big_endian
+               : sofh_encoding::sbe_little_endian;
+}
+
+/**
+ * @brief Decodes SOFH
+ *
+ * @param ptr header start, should point to at least `sbepp::sofh_size()`
+ *  bytes
+ * @return decoded header, it's not validated
+ */
+template<typename Byte>
+SBEPP_CPP20_CONSTEXPR sofh_header decode_sofh(const Byte* ptr) noexcept
+{
+    return {
+        detail::get_primitive<std::uint32_t, endian::big>(ptr),
+        static_cast<sofh_encoding>(
+            detail::get_primitive<std::uint16_t, endian::big>(
+                ptr + sizeof(std::uint32_t)))};
+}
+
+/**
+ * @brief Encodes SOFH
+ *
+ * Message is expected to be placed right after the header:
+ * ```cpp
+ * auto m = sbepp::make_view<market::messages::msg>(
+ *     buf + sbepp::sofh_size(), size - sbepp::sofh_size());
+ * // fill the message...
+ * auto frame_end = sbepp::encode_sofh(
+ *     buf,
+ *     sbepp::size_bytes(m),
+ *     sbepp::sofh_schema_encoding<market::schema>());
+ * ```
+ *
+ * @param ptr header start, should point to at least `sbepp::sofh_size()`
+ *  bytes
+ * @param message_size size of the message that follows the header
+ * @param encoding encoding type
+ * @return pointer past the end of the message
+ */
+template<typename Byte>
+SBEPP_CPP20_CONSTEXPR Byte* encode_sofh(
+    Byte* ptr,
+    const std::size_t message_size,
+    const sofh_encoding encoding) noexcept
+{
+    SBEPP_ASSERT(
+        message_size
+        <= std::numeric_limits<std::uint32_t>::max() - sofh_size());
+    const auto length = static_cast<std::uint32_t>(message_size + sofh_size());
+    detail::set_primitive<endian::big>(ptr, length);
+    detail::set_primitive<endian::big>(
+        ptr + sizeof(std::uint32_t), sbepp::to_underlying(encoding));
+    return ptr + length;
+}
+
+//! @brief `sbepp::message_stream` framing policy, messages follow each other
+//!  without any framing
+struct no_framing
+{
+};
+
+/**
+ * @brief `sbepp::message_stream` framing policy, each message is preceded by
+ *  `sbepp::sofh_header` whose encoding type should match the schema byte order
+ */
+struct sofh_framing
+{
+};
+
+namespace detail
+{
+inline void prefetch(const void* ptr) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(ptr);
+#else
+    (void)ptr;
+#endif
+}
+
+template<typename Byte>
+struct stream_frame
+{
+    // message start, `nullptr` if frame is invalid or incomplete
+    Byte* message;
+    // the maximum size of the message
+    std::size_t size;
+    // the next frame start, `nullptr` if it's defined by the message size
+    Byte* next;
+};
+
+template<typename SchemaTag, typename Byte>
+SBEPP_CPP20_CONSTEXPR stream_frame<Byte>
+    read_frame(no_framing, Byte* ptr, Byte* end) noexcept
+{
+    return {ptr, available_size(ptr, end), nullptr};
+}
+
+template<typename SchemaTag, typename Byte>
+SBEPP_CPP20_CONSTEXPR stream_frame<Byte>
+    read_frame(sofh_framing, Byte* ptr, Byte* end) noexcept
+{
+    const auto available = available_size(ptr, end);
+    if(available < sofh_size())
+    {
+        return {};
+    }
+
+    const auto header = decode_sofh(ptr);
+    if((header.message_length < sofh_size())
+       || (header.message_length > available)
+       || (header.encoding != sofh_schema_encoding<SchemaTag>()))
+    {
+        return {};
+    }
+
+    return {
+        ptr + sofh_size(),
+        header.message_length - sofh_size(),
+        ptr + header.message_length};
+}
+
+// validates dispatched message and passes it to `Callback`
+template<typename Byte, typename Callback>
+class stream_visitor
+{
+public:
+    constexpr stream_visitor(
+        const std::size_t size, Byte* next, Callback& callback) noexcept
+        : size{size}, next{next}, callback{&callback}
+    {
+    }
+
+    template<typename Message>
+    SBEPP_CPP20_CONSTEXPR void operator()(const Message m)
+    {
+        // size checks are done by `size_bytes_checked` itself, unchecked view
+        // is used to avoid assertions on incomplete messages
+        const auto res = sbepp::size_bytes_checked(
+            Message{sbepp::addressof(m), static_cast<Byte*>(nullptr)}, size);
+        if(!res.valid)
+        {
+            return;
+        }
+
+        if(!next)
+        {
+            next = sbepp::addressof(m) + res.size;
+        }
+        // let the next header arrive while the current message is processed
+        prefetch(next);
+        (*callback)(m, res.size);
+    }
+
+    constexpr Byte* get_next() const noexcept
+    {
+        return next;
+    }
+
+private:
+    std::size_t size;
+    Byte* next;
+    Callback* callback;
+};
+
+// handles the message at `ptr`, returns the next frame start or `nullptr` if
+// the message is unknown, invalid or incomplete
+template<typename SchemaTag, typename Framing, typename Byte, typename Callback>
+SBEPP_CPP20_CONSTEXPR Byte*
+    stream_next(Byte* ptr, Byte* end, Callback& callback)
+{
+    const auto frame = read_frame<SchemaTag>(Framing{}, ptr, end);
+    using header_tag = typename schema_traits<SchemaTag>::header_type_tag;
+    if(!frame.message
+       || (frame.size < composite_traits<header_tag>::size_bytes()))
+    {
+        return nullptr;
+    }
+
+    stream_visitor<Byte, Callback> visitor{frame.size, frame.next, callback};
+    if(sbepp::dispatch<SchemaTag>(frame.message, frame.size, visitor)
+       != dispatch_result::dispatched)
+    {
+        return nullptr;
+    }
+    // `next` is preset for framed messages, check that the message was valid
+    return frame.next ? (visitor.get_next() ? frame.next : nullptr)
+                      : visitor.get_next();
+}
+
+template<typename Visitor>
+class stream_message_callback
+{
+public:
+    explicit constexpr stream_message_callback(Visitor& visitor) noexcept
+        : visitor{&visitor}
+    {
+    }
+
+    template<typename Message>
+    SBEPP_CPP20_CONSTEXPR void operator()(const Message m, std::size_t)
+    {
+        (*visitor)(m);
+    }
+
+private:
+    Visitor* visitor;
+};
+} // namespace detail
+
+/**
+ * @brief Type-erased message from `sbepp::message_stream`
+ *
+ * @tparam Byte byte type
+ */
+template<typename Byte>
+class stream_message
+{
+public:
+    //! @brief Constructs an empty message
+    stream_message() = default;
+
+    /**
+     * @brief Constructs from message location and ID
+     *
+     * @param data message start
+     * @param size message size
+     * @param template_id message ID
+     */
+    constexpr stream_message(
+        Byte* data,
+        const std::size_t size,
+        const message_id_t template_id) noexcept
+        : ptr{data}, message_size{size}, id{template_id}
+    {
+    }
+
+    //! @brief Returns message start
+    constexpr Byte* data() const noexcept
+    {
+        return ptr;
+    }
+
+    //! @brief Returns message size, it's validated by `sbepp::message_stream`
+    constexpr std::size_t size() const noexcept
+    {
+        return message_size;
+    }
+
+    //! @brief Returns message `templateId`
+    constexpr message_id_t template_id() const noexcept
+    {
+        return id;
+    }
+
+private:
+    Byte* ptr{};
+    std::size_t message_size{};
+    message_id_t id{};
+};
+
+/**
+ * @brief Range of back-to-back messages of a single schema in a buffer
+ *
+ * Each message is validated using `sbepp::size_bytes_checked()` before it's
+ * passed to the client. Iteration stops at the first message which is unknown,
+ * invalid or doesn't fit into the buffer. Header of the next message is
+ * prefetched while the current one is processed. Example:
+ * ```cpp
+ * auto stream = sbepp::make_message_stream<market::schema>(data, size);
+ * const auto consumed = stream.for_each(overloaded{
+ *     [](market::messages::msg1<const char> m){},
+ *     [](auto){} // not interested in other messages
+ * });
+ * // keep remaining `size - consumed` bytes until the next read
+ * ```
+ *
+ * @tparam SchemaTag schema tag
+ * @tparam Byte byte type
+ * @tparam Framing either `sbepp::no_framing` or `sbepp::sofh_framing`
+ */
+template<typename SchemaTag, typename Byte, typename Framing = no_framing>
+class message_stream
+{
+public:
+    //! @brief Byte type
+    using byte_type = Byte;
+    //! @brief Value type
+    using value_type = stream_message<Byte>;
+
+    //! @brief Forward iterator over stream messages
+    class iterator
+    {
+    public:
+        //! @brief Iterator category
+        using iterator_category = std::forward_iterator_tag;
+        //! @brief Value type
+        using value_type = stream_message<Byte>;
+        //! @brief Reference type
+        using reference = value_type;
+        //! @brief Difference type
+        using difference_type = std::ptrdiff_t;
+        //! @brief Pointer type
+        using pointer = detail::arrow_proxy<value_type>;
+
+        //! @brief Constructs the end iterator
+        iterator() = default;
+
+        //! @brief Returns the current message
+        constexpr reference operator*() const noexcept
+        {
+            return current;
+        }
+
+        //! @brief Provides access to the current message members
+        constexpr pointer operator->() const noexcept
+        {
+            return pointer{current};
+        }
+
+        //! @brief Advances to the next message
+        SBEPP_CPP20_CONSTEXPR iterator& operator++() noexcept
+        {
+            read(next);
+            return *this;
+        }
+
+        //! @brief Advances to the next message
+        SBEPP_CPP20_CONSTEXPR iterator operator++(int) noexcept
+        {
+            auto old = *this;
+            ++(*this);
+            return old;
+        }
+
+        //! @brief Tests if iterators are equal
+        friend constexpr bool
+            operator==(const iterator& lhs, const iterator& rhs) noexcept
+        {
+            return lhs.current.data() == rhs.current.data();
+        }
+
+        //! @brief Tests if iterators are not equal
+        friend constexpr bool
+            operator!=(const iterator& lhs, const iterator& rhs) noexcept
+        {
+            return lhs.current.data() != rhs.current.data();
+        }
+
+    private:
+        friend class message_stream;
+
+        value_type current;
+        Byte* next{};
+        Byte* end{};
+
+        SBEPP_CPP20_CONSTEXPR iterator(Byte* begin, Byte* end) noexcept
+            : end{end}
+        {
+            read(begin);
+        }
+
+        struct recorder
+        {
+            value_type* message;
+
+            template<typename Message>
+            SBEPP_CPP20_CONSTEXPR void
+                operator()(const Message m, const std::size_t size) noexcept
+            {
+                *message = value_type{
+                    sbepp::addressof(m),
+                    size,
+                    message_traits<traits_tag_t<Message>>::id()};
+            }
+        };
+
+        SBEPP_CPP20_CONSTEXPR void read(Byte* ptr) noexcept
+        {
+            current = {};
+            if(ptr == end)
+            {
+                return;
+            }
+
+            recorder r{&current};
+            next = detail::stream_next<SchemaTag, Framing>(ptr, end, r);
+            if(!next)
+            {
+                current = {};
+            }
+        }
+    };
+
+    //! @brief Constructs an empty stream
+    message_stream() = default;
+
+    /**
+     * @brief Constructs from a buffer
+     *
+     * @param data buffer start
+     * @param size buffer size
+     */
+    constexpr message_stream(Byte* data, const std::size_t size) noexcept
+        : ptr{data}, stream_size{size}
+    {
+    }
+
+    //! @brief Returns iterator to the first message
+    SBEPP_CPP20_CONSTEXPR iterator begin() const noexcept
+    {
+        return iterator{ptr, ptr + stream_size};
+    }
+
+    //! @brief Returns the end iterator
+    constexpr iterator end() const noexcept
+    {
+        return iterator{};
+    }
+
+    /**
+     * @brief Calls `visitor` with each message view, dispatches each message
+     *  only once
+     *
+     * @param visitor callable which accepts all schema message views
+     * @return number of consumed bytes, less than the stream size if the last
+     *  message is incomplete or the stream contains invalid data
+     */
+    template<typename Visitor>
+    SBEPP_CPP20_CONSTEXPR std::size_t for_each(Visitor&& visitor) const
+    {
+        detail::stream_message_callback<detail::remove_reference_t<Visitor>>
+            callback{visitor};
+        auto current = ptr;
+        const auto end = ptr + stream_size;
+        while(current != end)
+        {
+            const auto next =
+                detail::stream_next<SchemaTag, Framing>(current, end, callback);
+            if(!next)
+            {
+                break;
+            }
+            current = next;
+        }
+
+        return static_cast<std::size_t>(current - ptr);
+    }
+
+private:
+    Byte* ptr{};
+    std::size_t stream_size{};
+};
+
+/**
+ * @brief Creates `sbepp::message_stream` from a buffer
+ *
+ * @tparam SchemaTag schema tag
+ * @tparam Framing either `sbepp::no_framing` or `sbepp::sofh_framing`
+ * @param data buffer start
+ * @param size buffer size
+ * @return message stream
+ */
+template<typename SchemaTag, typename Framing = no_framing, typename Byte>
+constexpr message_stream<SchemaTag, Byte, Framing>
+    make_message_stream(Byte* data, const std::size_t size) noexcept
+{
+    return {data, size};
+}
+
+/**
+ * @brief Complete frame from `sbepp::sofh_reassembler`
+ *
+ * @tparam Byte byte type
+ */
+template<typename Byte>
+class sofh_frame
+{
+public:
+    //! @brief Constructs an empty frame
+    sofh_frame() = default;
+
+    /**
+     * @brief Constructs from the frame start and decoded header
+     *
+     * @param frame frame start, i.e. SOFH start
+     * @param header decoded SOFH
+     */
+    constexpr sofh_frame(Byte* frame, const sofh_header header) noexcept
+        : ptr{frame}, header{header}
+    {
+    }
+
+    //! @brief Returns message start
+    constexpr Byte* data() const noexcept
+    {
+        return ptr + sofh_size();
+    }
+
+    //! @brief Returns message size
+    constexpr std::size_t size() const noexcept
+    {
+        return header.message_length - sofh_size();
+    }
+
+    //! @brief Returns encoding type
+    constexpr sofh_encoding encoding() const noexcept
+    {
+        return header.encoding;
+    }
+
+private:
+    Byte* ptr{};
+    sofh_header header{};
+};
+
+/**
+ * @brief Incrementally reassembles SOFH frames from arbitrary chunks of a byte
+ *  stream, e.g. from TCP `recv()`
+ *
+ * Frames which are fully contained within a chunk are passed to the client
+ * directly from it. Only frames split between chunks are copied into the
+ * client-provided buffer which must be large enough to hold the largest frame.
+ * Example:
+ * ```cpp
+ * std::array<char, 4096> storage;
+ * sbepp::sofh_reassembler<char> reassembler{storage.data(), storage.size()};
+ *
+ * while(auto n = recv(fd, buf, sizeof(buf), 0))
+ * {
+ *     const auto ok = reassembler.feed(
+ *         buf, n, [](const sbepp::sofh_frame<const char> frame)
+ *         {
+ *             sbepp::dispatch<market::schema>(
+ *                 frame.data(), frame.size(), visitor);
+ *         });
+ *     if(!ok)
+ *     {
+ *         // corrupted stream
+ *     }
+ * }
+ * ```
+ *
+ * @tparam Byte byte type
+ */
+template<typename Byte>
+class sofh_reassembler
+{
+public:
+    //! @brief Frame type passed to the callback
+    using frame_type = sofh_frame<const Byte>;
+
+    /**
+     * @brief Constructs from a buffer for split frames
+     *
+     * @param buffer buffer start
+     * @param capacity buffer size
+     */
+    constexpr sofh_reassembler(
+        Byte* buffer, const std::size_t capacity) noexcept
+        : buffer{buffer}, buffer_capacity{capacity}
+    {
+    }
+
+    /**
+     * @brief Processes the next chunk of data
+     *
+     * @param data chunk start
+     * @param size chunk size
+     * @param on_frame callback which is called with `frame_type` for each
+     *  complete frame
+     * @return `false` if the stream is corrupted, i.e. frame length is less
+     *  than `sbepp::sofh_size()` or split frame doesn't fit into the buffer.
+     *  After that, `reset()` should be called before processing more data.
+     */
+    template<typename F>
+    SBEPP_CPP20_CONSTEXPR bool
+        feed(const Byte* data, const std::size_t size, F&& on_frame)
+    {
+        auto ptr = data;
+        const auto end = data + size;
+
+        if(buffered)
+        {
+            ptr = complete_buffered(ptr, end);
+            if(!ptr)
+            {
+                return false;
+            }
+            if((buffered < sofh_size()) || (buffered != frame_length()))
+            {
+                // still incomplete
+                return true;
+            }
+            on_frame(frame_type{buffer, decode_sofh(buffer)});
+            buffered = 0;
+        }
+
+        while(static_cast<std::size_t>(end - ptr) >= sofh_size())
+        {
+            const auto header = decode_sofh(ptr);
+            if(header.message_length < sofh_size())
+            {
+                return false;
+            }
+            if(header.message_length > static_cast<std::size_t>(end - ptr))
+            {
+                break;
+            }
+            on_frame(frame_type{ptr, header});
+            ptr += header.message_length;
+        }
+
+        // keep the tail until the next chunk
+        if(ptr != end)
+        {
+            ptr = append(ptr, end, static_cast<std::size_t>(end - ptr));
+            if(!ptr || !has_valid_length())
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    //! @brief Returns the number of buffered bytes of a split frame
+    constexpr std::size_t buffered_size() const noexcept
+    {
+        return buffered;
+    }
+
+    //! @brief Returns buffer size
+    constexpr std::size_t capacity() const noexcept
+    {
+        return buffer_capacity;
+    }
+
+    //! @brief Drops buffered data
+    SBEPP_CPP14_CONSTEXPR void reset() noexcept
+    {
+        buffered = 0;
+    }
+
+private:
+    Byte* buffer;
+    std::size_t buffer_capacity;
+    std::size_t buffered{};
+
+    SBEPP_CPP20_CONSTEXPR std::size_t frame_length() const noexcept
+    {
+        return decode_sofh(buffer).message_length;
+    }
+
+    // copies up to `n` bytes into buffer, returns pointer past the last copied
+    // byte or `nullptr` if they don't fit
+    SBEPP_CPP20_CONSTEXPR const Byte*
+        append(const Byte* ptr, const Byte* end, std::size_t n) noexcept
+    {
+        n = std::min(n, static_cast<std::size_t>(end - ptr));
+        if(n > (buffer_capacity - buffered))
+        {
+            return nullptr;
+        }
+        std::copy(ptr, ptr + n, buffer + buffered);
+        buffered += n;
+        return ptr + n;
+    }
+
+    // checks frame length once the whole header is buffered
+    SBEPP_CPP20_CONSTEXPR bool has_valid_length() const noexcept
+    {
+        return (buffered < sofh_size())
+               || ((frame_length() >= sofh_size())
+                   && (frame_length() <= buffer_capacity));
+    }
+
+    SBEPP_CPP20_CONSTEXPR const Byte*
+        complete_buffered(const Byte* ptr, const Byte* end) noexcept
+    {
+        if(buffered < sofh_size())
+        {
+            ptr = append(ptr, end, sofh_size() - buffered);
+            if(!ptr || (buffered < sofh_size()))
+            {
+                return ptr;
+            }
+        }
+
+        if(!has_valid_length())
+        {
+            return nullptr;
+        }
+
+        return append(ptr, end, frame_length() - buffered);
+    }
+};
+
+/**
+ * @brief Buffer which consists of two contiguous segments, e.g. a wrapped
+ *  region of a ring buffer
+ *
+ * @tparam Byte byte type
+ */
+template<typename Byte>
+class segmented_buffer
+{
+public:
+    //! @brief Constructs an empty buffer
+    segmented_buffer() = default;
+
+    /**
+     * @brief Constructs from two segments
+     *
+     * @param first first segment start
+     * @param first_size first segment size
+     * @param second second segment start
+     * @param second_size second segment size
+     */
+    constexpr segmented_buffer(
+        Byte* first,
+        const std::size_t first_size,
+        Byte* second,
+        const std::size_t second_size) noexcept
+        : first_ptr{first},
+          second_ptr{second},
+          first_segment_size{first_size},
+          second_segment_size{second_size}
+    {
+    }
+
+    //! @brief Returns the first segment start
+    constexpr Byte* first() const noexcept
+    {
+        return first_ptr;
+    }
+
+    //! @brief Returns the first segment size
+    constexpr std::size_t first_size() const noexcept
+    {
+        return first_segment_size;
+    }
+
+    //! @brief Returns the second segment start
+    constexpr Byte* second() const noexcept
+    {
+        return second_ptr;
+    }
+
+    //! @brief Returns the second segment size
+    constexpr std::size_t second_size() const noexcept
+    {
+        return second_segment_size;
+    }
+
+    //! @brief Returns total size of both segments
+    constexpr std::size_t size() const noexcept
+    {
+        return first_segment_size + second_segment_size;
+    }
+
+private:
+    Byte* first_ptr{};
+    Byte* second_ptr{};
+    std::size_t first_segment_size{};
+    std::size_t second_segment_size{};
+};
+
+namespace detail
+{
+template<typename Byte>
+struct linearized_message
+{
+    // message start, `nullptr` if message is invalid or incomplete
+    Byte* data;
+    std::size_t size;
+};
+
+// returns in-place message if it's fully contained within the first non-empty
+// segment, otherwise, copies it into `scratch`. Since message size is unknown
+// until it's complete, the second segment is copied in chunks of growing size.
+// `Probe(ptr, size)` should return `size_bytes_checked_result` of the message
+// at `ptr`.
+template<typename Byte, typename Probe>
+SBEPP_CPP20_CONSTEXPR linearized_message<Byte> linearize(
+    const segmented_buffer<Byte> buffer,
+    remove_cv_t<Byte>* scratch,
+    const std::size_t scratch_size,
+    Probe probe) noexcept
+{
+    auto first = buffer.first();
+    auto first_size = buffer.first_size();
+    auto second = buffer.second();
+    auto second_size = buffer.second_size();
+    if(!first_size)
+    {
+        first = second;
+        first_size = second_size;
+        second_size = 0;
+    }
+
+    auto res = probe(first, first_size);
+    if(res.valid)
+    {
+        return {first, res.size};
+    }
+
+    // slow path, message crosses the segment boundary
+    if(first_size > scratch_size)
+    {
+        return {};
+    }
+    std::copy(first, first + first_size, scratch);
+
+    std::size_t copied = first_size;
+    std::size_t taken{};
+    std::size_t chunk_size = first_size;
+    while(true)
+    {
+        res = probe(scratch, copied);
+        if(res.valid)
+        {
+            return {scratch, res.size};
+        }
+
+        const auto n = std::min(
+            chunk_size,
+            std::min(second_size - taken, scratch_size - copied));
+        if(!n)
+        {
+            return {};
+        }
+
+        std::copy(second + taken, second + taken + n, scratch + copied);
+        copied += n;
+        taken += n;
+        chunk_size *= 2;
+    }
+}
+
+template<template<typename> class View>
+struct message_size_probe
+{
+    template<typename Byte>
+    SBEPP_CPP20_CONSTEXPR size_bytes_checked_result
+        operator()(Byte* ptr, const std::size_t size) const noexcept
+    {
+        const View<Byte> m{ptr, static_cast<Byte*>(nullptr)};
+        if(size < unchecked_header_size(m))
+        {
+            return {};
+        }
+        return sbepp::size_bytes_checked(m, size);
+    }
+};
+
+struct template_id_recorder
+{
+    message_id_t* template_id;
+
+    template<typename Message>
+    SBEPP_CPP20_CONSTEXPR void
+        operator()(const Message, const std::size_t) const noexcept
+    {
+        *template_id = message_traits<traits_tag_t<Message>>::id();
+    }
+};
+
+template<typename SchemaTag>
+struct schema_message_size_probe
+{
+    message_id_t* template_id;
+
+    template<typename Byte>
+    SBEPP_CPP20_CONSTEXPR size_bytes_checked_result
+        operator()(Byte* ptr, const std::size_t size) const noexcept
+    {
+        template_id_recorder recorder{template_id};
+        const auto next =
+            stream_next<SchemaTag, no_framing>(ptr, ptr + size, recorder);
+        if(!next)
+        {
+            return {};
+        }
+        return {true, static_cast<std::size_t>(next - ptr)};
+    }
+};
+} // namespace detail
+
+/**
+ * @brief Creates a message view from a segmented buffer
+ *
+ * If the message is fully contained within a single segment, the view refers
+ * to it directly. Only if the message crosses the segment boundary, it's copied
+ * into `scratch`. Resulting view is bounded by the message size so
+ * `sbepp::size_bytes()` can be used to find the next message position.
+ *
+ * @tparam View message view template
+ * @param buffer segmented buffer, the message should start at the beginning
+ *  of its first segment
+ * @param scratch buffer for messages crossing the segment boundary
+ * @param scratch_size `scratch` size
+ * @return message view or `sbepp::access_error::out_of_bounds` if the message
+ *  is incomplete or doesn't fit into `scratch`
+ */
+template<template<typename> class View, typename Byte>
+SBEPP_CPP20_CONSTEXPR access_result<View<Byte>> make_segmented_view(
+    const segmented_buffer<Byte> buffer,
+    detail::remove_cv_t<Byte>* scratch,
+    const std::size_t scratch_size) noexcept
+{
+    const auto res = detail::linearize(
+        buffer, scratch, scratch_size, detail::message_size_probe<View>{});
+    if(!res.data)
+    {
+        return access_error::out_of_bounds;
+    }
+    return View<Byte>{res.data, res.size};
+}
+
+/**
+ * @brief Type-erased version of `sbepp::make_segmented_view()` for messages
+ *  of any schema message type
+ *
+ * The result can be passed to `sbepp::dispatch()`.
+ *
+ * @tparam SchemaTag schema tag
+ * @param buffer segmented buffer, the message should start at the beginning
+ *  of its first segment
+ * @param scratch buffer for messages crossing the segment boundary
+ * @param scratch_size `scratch` size
+ * @return type-erased message or `sbepp::access_error::out_of_bounds` if the
+ *  message is unknown, incomplete or doesn't fit into `scratch`
+ */
+template<typename SchemaTag, typename Byte>
+SBEPP_CPP20_CONSTEXPR access_result<stream_message<Byte>>
+    make_segmented_message(
+        const segmented_buffer<Byte> buffer,
+        detail::remove_cv_t<Byte>* scratch,
+        const std::size_t scratch_size) noexcept
+{
+    message_id_t template_id{};
+    const auto res = detail::linearize(
+        buffer,
+        scratch,
+        scratch_size,
+        detail::schema_message_size_probe<SchemaTag>{&template_id});
+    if(!res.data)
+    {
+        return access_error::out_of_bounds;
+    }
+
+    return stream_message<Byte>{res.data, res.size, template_id};
+}
+
+namespace detail
+{
+template<template<typename> class Trait, typename T, typename = void_t<>>
+struct has_traits : std::false_type
+{
+};
+
+template<template<typename> class Trait, typename T>
+struct has_traits<Trait, T, void_t<decltype(Trait<T>{})>> : std::true_type
+{
+};
+} // namespace detail
+
+/**
+ * @brief Checks if `Tag` is a type tag
+ *
+ * Equivalent to `std::true_type` if `Tag` is a type tag, `std::false_type`
+ * otherwise. Requires `Tag` traits to be available for correct behavior.
+ */
+template<typename Tag>
+using is_type_tag = detail::has_traits<type_traits, Tag>;
+
+/**
+ * @brief Checks if `Tag` is an enum tag
+ *
+ * Equivalent to `std::true_type` if `Tag` is an enum tag, `std::false_type`
+ * otherwise. Requires `Tag` traits to be available for correct behavior.
+ */
+template<typename Tag>
+using is_enum_tag = detail::has_traits<enum_traits, Tag>;
+
+/**
+ * @brief Checks if `Tag` is an enum value tag
+ *
+ * Equivalent to `std::true_type` if `Tag` is an enum value tag,
+ * `std::false_type` otherwise. Requires `Tag` traits to be available for
+ * correct behavior.
+ */
+template<typename Tag>
+using is_enum_value_tag = detail::has_traits<enum_value_traits, Tag>;
+
+/**
  * @brief Checks if `Tag` is a set tag
  *
  * Equivalent to `std::true_type` if `Tag` is a set tag, `std::false_type`
@@ -6009,9 +10737,14 @@ concept schema_tag = is_schema_tag_v<Tag>;
 
 #if SBEPP_HAS_RANGES && SBEPP_HAS_CONCEPTS
 
-template<typename Byte, typename Value, std::size_t N, typename Tag>
+template<
+    typename Byte,
+    typename Value,
+    std::size_t N,
+    typename Tag,
+    sbepp::endian E>
 inline constexpr bool std::ranges::enable_borrowed_range<
-    sbepp::detail::static_array_ref<Byte, Value, N, Tag>> = true;
+    sbepp::detail::static_array_ref<Byte, Value, N, Tag, E>> = true;
 
 template<typename Byte, typename Value, typename Length, sbepp::endian E>
 inline constexpr bool std::ranges::enable_borrowed_range<
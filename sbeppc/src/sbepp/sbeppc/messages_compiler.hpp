@@ -312,6 +312,131 @@ R"(
         return {};
     }
 
+    struct block_member
+    {
+        std::string_view name;
+        std::string type;
+        std::string underlying_type;
+        offset_t offset;
+        std::size_t size;
+    };
+
+    // returns fields which can be represented by a plain value, composites and
+    // arrays are represented by views so they are not a part of the block
+    std::vector<block_member> get_block_members(
+        const std::vector<sbe::field>& fields, const std::size_t header_size)
+    {
+        std::vector<block_member> res;
+
+        for(const auto& f : fields)
+        {
+            const auto& context = ctx_manager->get(f);
+            if((context.actual_presence == field_presence::constant)
+               || context.is_template)
+            {
+                continue;
+            }
+
+            auto underlying_type = context.value_type + "::value_type";
+            if(!utils::is_primitive_type(f.type))
+            {
+                const auto& enc = utils::get_schema_encoding(*schema, f.type);
+                if(std::holds_alternative<sbe::enumeration>(enc))
+                {
+                    underlying_type = context.value_type;
+                }
+                else if(const auto s = std::get_if<sbe::set>(&enc))
+                {
+                    underlying_type = ctx_manager->get(*s).underlying_type;
+                }
+            }
+
+            res.push_back(
+                {f.name,
+                 context.value_type,
+                 std::move(underlying_type),
+                 context.level_offset + header_size,
+                 context.size});
+        }
+
+        return res;
+    }
+
+    static std::string make_block_struct(
+        const std::vector<block_member>& members,
+        const std::string_view block_namespace,
+        const std::string_view name)
+    {
+        std::string member_declarations;
+        for(const auto& m : members)
+        {
+            member_declarations +=
+                fmt::format("    {} {};\n", m.type, m.name);
+        }
+
+        return fmt::format(
+            // clang-format off
+R"(
+namespace {block_namespace}
+{{
+struct {name}
+{{
+{members}}};
+}} // namespace {block_namespace}
+)",
+            // clang-format on
+            fmt::arg("block_namespace", block_namespace),
+            fmt::arg("name", name),
+            fmt::arg("members", member_declarations));
+    }
+
+    std::string make_block_loader(
+        const std::vector<block_member>& members,
+        const std::string_view block_type,
+        const std::size_t header_size) const
+    {
+        // check the whole block at once instead of checking each field
+        std::size_t block_end = header_size;
+        for(const auto& m : members)
+        {
+            block_end = std::max<std::size_t>(block_end, m.offset + m.size);
+        }
+
+        std::vector<std::string> values;
+        values.reserve(members.size());
+        const auto endian = utils::byte_order_to_endian(schema->byte_order);
+        for(const auto& m : members)
+        {
+            values.push_back(
+                fmt::format(
+                    "::sbepp::detail::get_block_value<{}, {}, {}>(*this, {})",
+                    m.type,
+                    m.underlying_type,
+                    endian,
+                    m.offset));
+        }
+
+        return fmt::format(
+            // clang-format off
+R"(
+    SBEPP_CPP20_CONSTEXPR {block_type} operator()(
+        ::sbepp::detail::load_block_tag) const noexcept
+    {{
+        SBEPP_SIZE_CHECK(
+            (*this)(::sbepp::detail::addressof_tag{{}}),
+            (*this)(::sbepp::detail::end_ptr_tag{{}}),
+            0,
+            {block_end});
+        return {block_type}{{
+            {values}}};
+    }}
+)",
+            // clang-format on
+            fmt::arg("block_type", block_type),
+            fmt::arg("block_end", block_end),
+            fmt::arg("values", fmt::join(values, ",\n            ")));
+    }
+
     std::string make_group_entry(const sbe::group& g)
     {
         const auto& dimension_type =
@@ -332,12 +457,17 @@ R"(
         const auto block_length_type = get_block_length_type(dimension_type);
         const auto base_class = fmt::format(
             "::sbepp::detail::entry_base<Byte, {}>", block_length_type);
+        const auto block_members = get_block_members(g.members.fields, 0);
+        const auto block_type = fmt::format(
+            "::{}::detail::messages::entry_blocks::{}",
+            ctx_manager->get(*schema).name,
+            class_name);
 
         return fmt::format(
             // clang-format off
 R"(
 {groups_impl}
-
+{block_struct}
 template<typename Byte>
 class {name} : public {base_class}
 {{
@@ -348,6 +478,7 @@ public:
     {cursor_constructor}
     {accessors}
     {size_bytes_impl}
+    {block_loader}
 
     template<typename Visitor, typename Cursor>
     constexpr bool operator()(
@@ -370,6 +501,12 @@ public:
                 make_entry_cursor_constructor(
                     g.members, class_name, block_length_type, base_class)),
             fmt::arg("groups_impl", groups_impl),
+            fmt::arg(
+                "block_struct",
+                make_block_struct(block_members, "entry_blocks", class_name)),
+            fmt::arg(
+                "block_loader",
+                make_block_loader(block_members, block_type, 0)),
             fmt::arg("visit_children_impl", make_visit_children(g.members)));
     }
 
@@ -1671,6 +1808,15 @@ R"(
             get_last_member(m.members),
             header_context.size);
         const auto visit_children_impl = make_visit_children(m.members);
+        const auto& class_name = message_context.mangled_name.value_or(m.name);
+        const auto block_members =
+            get_block_members(m.members.fields, header_context.size);
+        const auto block_type = fmt::format(
+            "::{}::detail::messages::message_blocks::{}",
+            schema_name,
+            class_name);
+        const auto block_struct =
+            make_block_struct(block_members, "message_blocks", class_name);
 
         // it's not possible to make `operator()(visit_tag)` `constexpr` because
         // C++11 doesn't allow such function to return `void`
@@ -1690,6 +1836,7 @@ public:
 {accessors}
 {header_filler}
 {size_getter}
+{block_loader}
 
     template<typename Visitor, typename Cursor>
     SBEPP_CPP14_CONSTEXPR void operator()(
@@ -1702,12 +1849,16 @@ public:
 }};
 )",
             // clang-format on
-            fmt::arg("name", message_context.mangled_name.value_or((m.name))),
+            fmt::arg("name", class_name),
             fmt::arg("header_type", header_type),
             fmt::arg("accessors", accessors),
             fmt::arg("size_getter", size_bytes_impl),
             fmt::arg("header_filler", make_message_header_filler(m)),
             fmt::arg("visit_children_impl", visit_children_impl),
+            fmt::arg(
+                "block_loader",
+                make_block_loader(
+                    block_members, block_type, header_context.size)),
             fmt::arg("tag", message_context.tag));
 
         const auto traits = traits_gen->make_message_traits(m);
@@ -1716,14 +1867,19 @@ public:
         {
             on_message_cb(
                 m.name,
-                groups + implementation,
+                groups + block_struct + implementation,
                 make_alias(m),
                 dependencies,
                 traits);
         }
         else
         {
-            on_message_cb(m.name, groups, implementation, dependencies, traits);
+            on_message_cb(
+                m.name,
+                groups + block_struct,
+                implementation,
+                dependencies,
+                traits);
         }
     }
 };
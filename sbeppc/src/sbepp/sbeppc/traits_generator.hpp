@@ -73,6 +73,16 @@ public:
     {header_type_tag}
     {type_tags}
     {message_tags}
+
+    template<typename Byte, typename Visitor>
+    static SBEPP_CPP14_CONSTEXPR bool dispatch(
+        const ::sbepp::message_id_t template_id,
+        Byte* data,
+        const ::std::size_t size,
+        Visitor&& visitor)
+    {{
+{dispatch_body}
+    }}
 }};
 )",
             // clang-format on
@@ -96,7 +106,8 @@ public:
             fmt::arg(
                 "message_tags",
                 make_type_list_alias(
-                    "message_tags", get_tags(schema->messages))));
+                    "message_tags", get_tags(schema->messages))),
+            fmt::arg("dispatch_body", make_dispatch_body()));
     }
 
     std::string make_message_traits(const sbe::message& m) const
@@ -977,6 +988,84 @@ R"(static constexpr ::std::size_t size_bytes({params}) noexcept
             fmt::arg("sum_terms", fmt::join(sum_terms, "\n+ ")));
     }
 
+    std::vector<std::string>
+        get_members_max_size_bytes(const sbe::level_members& members) const
+    {
+        std::vector<std::string> terms;
+        terms.reserve(members.groups.size() + members.data.size());
+
+        for(const auto& g : members.groups)
+        {
+            terms.push_back(
+                fmt::format(
+                    "::sbepp::group_traits<{}>::max_size_bytes()",
+                    ctx_manager->get(g).tag));
+        }
+
+        for(const auto& d : members.data)
+        {
+            terms.push_back(
+                fmt::format(
+                    "::sbepp::data_traits<{}>::max_size_bytes()",
+                    ctx_manager->get(d).tag));
+        }
+
+        return terms;
+    }
+
+    std::string make_group_max_size_bytes(const sbe::group& g) const
+    {
+        auto entry_terms = get_members_max_size_bytes(g.members);
+        entry_terms.emplace(std::begin(entry_terms), "block_length()");
+
+        return fmt::format(
+            // clang-format off
+R"(static constexpr ::std::size_t max_size_bytes() noexcept
+    {{
+        return ::sbepp::detail::saturating_sum(
+            ::sbepp::composite_traits<dimension_type_tag>::size_bytes(),
+            ::sbepp::detail::saturating_mul(
+                value_type<char>::max_size(),
+                ::sbepp::detail::saturating_sum(
+                    {entry_terms})));
+    }}
+)",
+            // clang-format on
+            fmt::arg("entry_terms", fmt::join(entry_terms, ",\n")));
+    }
+
+    // data without explicit `length` `maxValue` is considered unbounded even
+    // if its primitive type maximum fits into `std::size_t`
+    std::string make_data_max_size_bytes(const sbe::data& d) const
+    {
+        if(!ctx_manager->get(d).length_type->max_value)
+        {
+            return "::sbepp::unbounded_size_bytes";
+        }
+
+        return "::sbepp::detail::saturating_sum("
+               "sizeof(length_type::value_type), length_type::max_value())";
+    }
+
+    std::string make_message_max_size_bytes(const sbe::message& m) const
+    {
+        auto terms = get_members_max_size_bytes(m.members);
+        terms.emplace(std::begin(terms), "block_length()");
+
+        return fmt::format(
+            // clang-format off
+R"(static constexpr ::std::size_t max_size_bytes() noexcept
+    {{
+        return ::sbepp::detail::saturating_sum(
+            ::sbepp::composite_traits<
+                ::sbepp::schema_traits<schema_tag>::header_type_tag>::size_bytes(),
+            {terms});
+    }}
+)",
+            // clang-format on
+            fmt::arg("terms", fmt::join(terms, ",\n")));
+    }
+
     std::string make_traits_tag(const sbe::type& t) const
     {
         // `traits_tag` specialization for array types exists in sbepp.hpp. For
@@ -1069,6 +1158,7 @@ public:
     {value_type}
     {schema_tag}
     {size_bytes_impl}
+    {max_size_bytes_impl}
     {field_tags}
     {group_tags}
     {data_tags}
@@ -1089,6 +1179,7 @@ public:
                 utils::make_alias_template("value_type", context.public_type)),
             fmt::arg("deprecated_impl", make_deprecated(m.deprecated_since)),
             fmt::arg("size_bytes_impl", make_message_size_bytes(m)),
+            fmt::arg("max_size_bytes_impl", make_message_max_size_bytes(m)),
             fmt::arg(
                 "schema_tag",
                 utils::make_type_alias(
@@ -1252,6 +1343,7 @@ public:
     {dimension_type_tag}
     {entry_type}
     {size_bytes_impl}
+    {max_size_bytes_impl}
     {field_tags}
     {group_tags}
     {data_tags}
@@ -1287,6 +1379,7 @@ public:
             fmt::arg("level_traits", make_level_traits(g.members)),
             fmt::arg("deprecated_impl", make_deprecated(g.deprecated_since)),
             fmt::arg("size_bytes_impl", make_group_size_bytes(g)),
+            fmt::arg("max_size_bytes_impl", make_group_max_size_bytes(g)),
             fmt::arg(
                 "traits_tag",
                 make_templated_traits_tag(
@@ -1350,6 +1443,11 @@ public:
     {{
         return sizeof(size) + size;
     }}
+
+    static constexpr ::std::size_t max_size_bytes() noexcept
+    {{
+        return {max_size_bytes};
+    }}
 }};
 )",
             // clang-format on
@@ -1359,6 +1457,7 @@ public:
             fmt::arg("id", d.id),
             fmt::arg("since_version", d.added_since),
             fmt::arg("value_type", context.impl_type),
+            fmt::arg("max_size_bytes", make_data_max_size_bytes(d)),
             fmt::arg(
                 "length_type",
                 utils::make_type_alias(
@@ -1402,6 +1501,53 @@ public:
         return tags;
     }
 
+    std::string make_dispatch_body() const
+    {
+        if(schema->messages.empty())
+        {
+            // no cases, avoid unused parameter warnings
+            return
+                // clang-format off
+R"(        (void)template_id;
+        (void)data;
+        (void)size;
+        (void)visitor;
+        return false;)";
+            // clang-format on
+        }
+
+        return fmt::format(
+            // clang-format off
+R"(        switch(template_id)
+        {{
+{}
+        default:
+            return false;
+        }})",
+            // clang-format on
+            make_dispatch_cases());
+    }
+
+    // one `case` per message, compilers turn dense IDs into a jump table
+    std::string make_dispatch_cases() const
+    {
+        std::string res;
+        for(const auto& m : schema->messages)
+        {
+            res += fmt::format(
+                // clang-format off
+R"(        case {id}:
+            ::sbepp::detail::dispatch_message<{tag}>(data, size, visitor);
+            return true;
+)",
+                // clang-format on
+                fmt::arg("id", m.id),
+                fmt::arg("tag", ctx_manager->get(m).tag));
+        }
+
+        return res;
+    }
+
     std::vector<std::string_view> get_type_tags() const
     {
         std::vector<std::string_view> tags;
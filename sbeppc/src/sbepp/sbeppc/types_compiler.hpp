@@ -159,13 +159,14 @@ private:
                 // clang-format off
 R"(
 using {type_name} = ::sbepp::detail::static_array_ref<
-    const char, {element_type}, {length}, {tag}>;
+    const char, {element_type}, {length}, {tag}, {endian}>;
 )",
                 // clang-format on
                 fmt::arg("type_name", context.mangled_name.value_or(t.name)),
                 fmt::arg("element_type", context.underlying_type),
                 fmt::arg("length", t.length),
-                fmt::arg("tag", context.tag));
+                fmt::arg("tag", context.tag),
+                fmt::arg("endian", utils::byte_order_to_endian(byte_order)));
         }
         else
         {
@@ -186,13 +187,14 @@ using {type_name} = ::sbepp::detail::static_array_ref<
 R"(
 template<typename Byte>
 using {type_name} = ::sbepp::detail::static_array_ref<
-    Byte, {element_type}, {length}, {tag}>;
+    Byte, {element_type}, {length}, {tag}, {endian}>;
 )",
             // clang-format on
             fmt::arg("type_name", context.mangled_name.value_or(t.name)),
             fmt::arg("element_type", context.underlying_type),
             fmt::arg("length", t.length),
-            fmt::arg("tag", context.tag));
+            fmt::arg("tag", context.tag),
+            fmt::arg("endian", utils::byte_order_to_endian(byte_order)));
     }
 
     std::string make_required_type(const sbe::type& t) const
@@ -0,0 +1,258 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Oleksandr Koval
+
+#include <test_schema/test_schema.hpp>
+
+#include <sbepp/broadcast_log.hpp>
+#include <sbepp/test/utils.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using msg28_tag = test_schema::schema::messages::msg28;
+using log_t = sbepp::broadcast_log<test_schema::schema>;
+
+IS_SAME_TYPE(log_t::message_type, sbepp::stream_message<const std::uint8_t>);
+
+std::size_t message_size()
+{
+    return sbepp::message_traits<msg28_tag>::size_bytes(0, 0);
+}
+
+void publish(log_t& log, const std::uint32_t value)
+{
+    const auto claim = log.claim(message_size());
+    auto m = sbepp::make_view<test_schema::messages::msg28>(claim);
+    sbepp::fill_message_header(m);
+    m.required(value);
+    sbepp::fill_group_header(m.group(), 0);
+    m.varData().clear();
+    m.varStr().clear();
+    log.commit(claim, sbepp::size_bytes(m));
+}
+
+std::uint32_t decode(const log_t::message_type m)
+{
+    EXPECT_EQ(m.template_id(), sbepp::message_traits<msg28_tag>::id());
+    const auto view = sbepp::make_const_view<test_schema::messages::msg28>(
+        m.data(), m.size());
+    EXPECT_EQ(sbepp::size_bytes(view), m.size());
+    return *view.required();
+}
+
+TEST(BroadcastLogTest, SubscribersReadIndependently)
+{
+    log_t log{1024};
+    auto s1 = log.subscribe();
+    publish(log, 1);
+    auto s2 = log.subscribe();
+    publish(log, 2);
+
+    std::vector<std::uint32_t> values1;
+    std::vector<std::uint32_t> values2;
+    const auto count1 = s1.poll(
+        [&values1](const log_t::message_type m)
+        {
+            values1.push_back(decode(m));
+        });
+    const auto count2 = s2.poll(
+        [&values2](const log_t::message_type m)
+        {
+            values2.push_back(decode(m));
+        });
+
+    ASSERT_EQ(count1, 2u);
+    ASSERT_EQ(values1, (std::vector<std::uint32_t>{1, 2}));
+    ASSERT_EQ(count2, 1u);
+    ASSERT_EQ(values2, std::vector<std::uint32_t>{2});
+    ASSERT_EQ(s1.get_position(), s2.get_position());
+}
+
+TEST(BroadcastLogTest, UncommittedClaimBlocksSubscribers)
+{
+    log_t log{1024};
+    auto subscriber = log.subscribe();
+    const auto claim = log.claim(message_size());
+    publish(log, 2);
+
+    auto count = subscriber.poll([](const log_t::message_type) {});
+
+    ASSERT_EQ(count, 0u);
+
+    auto m = sbepp::make_view<test_schema::messages::msg28>(claim);
+    sbepp::fill_message_header(m);
+    m.required(1);
+    log.commit(claim, sbepp::message_traits<msg28_tag>::size_bytes(0, 0));
+    std::vector<std::uint32_t> values;
+    count = subscriber.poll(
+        [&values](const log_t::message_type m)
+        {
+            values.push_back(decode(m));
+        });
+
+    ASSERT_EQ(count, 2u);
+    ASSERT_EQ(values, (std::vector<std::uint32_t>{1, 2}));
+}
+
+TEST(BroadcastLogTest, WrapsAroundAndDetectsLapping)
+{
+    log_t log{1024};
+    auto fast = log.subscribe();
+    auto slow = log.subscribe();
+    std::uint32_t expected{};
+    for(std::uint32_t i = 0; i != 100; i++)
+    {
+        publish(log, i);
+        fast.poll(
+            [&expected](const log_t::message_type m)
+            {
+                ASSERT_EQ(decode(m), expected);
+                expected++;
+            });
+    }
+
+    ASSERT_EQ(expected, 100u);
+    ASSERT_EQ(fast.lapped_count(), 0u);
+
+    const auto count = slow.poll([](const log_t::message_type) {});
+
+    ASSERT_EQ(count, 0u);
+    ASSERT_EQ(slow.lapped_count(), 1u);
+
+    publish(log, 100);
+
+    ASSERT_EQ(
+        slow.poll(
+            [](const log_t::message_type m)
+            {
+                ASSERT_EQ(decode(m), 100u);
+            }),
+        1u);
+}
+
+TEST(BroadcastLogTest, DetectsLappingBetweenPolls)
+{
+    log_t log{1024};
+    auto subscriber = log.subscribe();
+    std::vector<std::uint32_t> values;
+    const auto handler = [&values](const log_t::message_type m)
+    {
+        values.push_back(decode(m));
+    };
+    publish(log, 0);
+    publish(log, 1);
+
+    ASSERT_EQ(subscriber.poll(handler, 1), 1u);
+
+    // overwrites the record at subscriber's position
+    std::uint32_t i = 2;
+    while(log.subscribe().get_position() - subscriber.get_position()
+          <= log.capacity())
+    {
+        publish(log, i);
+        i++;
+    }
+
+    ASSERT_EQ(subscriber.poll(handler), 0u);
+    ASSERT_EQ(subscriber.lapped_count(), 1u);
+    ASSERT_EQ(values, std::vector<std::uint32_t>{0});
+
+    publish(log, i);
+
+    ASSERT_EQ(subscriber.poll(handler), 1u);
+    ASSERT_EQ(values, (std::vector<std::uint32_t>{0, i}));
+}
+
+TEST(BroadcastLogTest, DetectsLappingWhileHandlingMessage)
+{
+    log_t log{1024};
+    auto subscriber = log.subscribe();
+    publish(log, 0);
+    publish(log, 1);
+    std::vector<std::uint32_t> values;
+
+    const auto count = subscriber.poll(
+        [&values, &log](const log_t::message_type m)
+        {
+            values.push_back(decode(m));
+            if(values.size() == 1)
+            {
+                for(std::uint32_t i = 0; i != 100; i++)
+                {
+                    publish(log, 100 + i);
+                }
+            }
+        });
+
+    ASSERT_EQ(count, 1u);
+    ASSERT_EQ(subscriber.lapped_count(), 1u);
+    ASSERT_EQ(values, std::vector<std::uint32_t>{0});
+}
+
+TEST(BroadcastLogTest, MultipleProducersAndSubscribers)
+{
+    constexpr std::uint32_t producer_count = 2;
+    constexpr std::uint32_t message_count = 1000;
+    log_t log{1 << 20};
+    auto s1 = log.subscribe();
+    auto s2 = log.subscribe();
+
+    std::vector<std::thread> producers;
+    for(std::uint32_t p = 0; p != producer_count; p++)
+    {
+        producers.emplace_back(
+            [&log, p]
+            {
+                for(std::uint32_t i = 0; i != message_count; i++)
+                {
+                    publish(log, p * message_count + i);
+                }
+            });
+    }
+
+    auto consume = [](log_t::subscriber& s)
+    {
+        std::vector<std::uint32_t> next(producer_count);
+        std::uint32_t total{};
+        bool in_order{true};
+        while(total != producer_count * message_count)
+        {
+            const auto count = s.poll(
+                [&next, &in_order](const log_t::message_type m)
+                {
+                    const auto value = decode(m);
+                    const auto p = value / message_count;
+                    in_order = in_order && (value % message_count == next[p]);
+                    next[p]++;
+                });
+            total += static_cast<std::uint32_t>(count);
+            if(!count)
+            {
+                std::this_thread::yield();
+            }
+        }
+        return in_order;
+    };
+    bool in_order1{};
+    std::thread consumer{[&]
+                         {
+                             in_order1 = consume(s1);
+                         }};
+    const auto in_order2 = consume(s2);
+    consumer.join();
+    for(auto& producer : producers)
+    {
+        producer.join();
+    }
+
+    ASSERT_TRUE(in_order1);
+    ASSERT_TRUE(in_order2);
+    ASSERT_EQ(s1.lapped_count(), 0u);
+    ASSERT_EQ(s2.lapped_count(), 0u);
+}
+} // namespace
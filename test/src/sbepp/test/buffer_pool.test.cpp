@@ -0,0 +1,196 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Oleksandr Koval
+
+#include <test_schema/test_schema.hpp>
+
+#include <sbepp/buffer_pool.hpp>
+#include <sbepp/test/utils.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace
+{
+STATIC_ASSERT_V(std::is_nothrow_move_constructible<sbepp::pooled_buffer>);
+STATIC_ASSERT_V(!std::is_copy_constructible<sbepp::pooled_buffer>);
+STATIC_ASSERT_V(!std::is_copy_constructible<sbepp::buffer_pool>);
+STATIC_ASSERT(
+    sbepp::buffer_pool::max_block_size()
+    == sbepp::buffer_pool::min_block_size()
+           << (sbepp::buffer_pool::size_class_count() - 1));
+
+std::size_t upstream_allocated;
+
+void* counting_allocate(const std::size_t size)
+{
+    upstream_allocated += size;
+    return ::operator new(size);
+}
+
+void counting_deallocate(void* ptr, const std::size_t size) noexcept
+{
+    upstream_allocated -= size;
+    ::operator delete(ptr);
+}
+
+TEST(BufferPoolTest, RoundsSizeUpToSizeClass)
+{
+    sbepp::buffer_pool pool;
+
+    const auto small = pool.allocate(1);
+    const auto medium = pool.allocate(100);
+    const auto large = pool.allocate(sbepp::buffer_pool::max_block_size() + 1);
+
+    ASSERT_EQ(small.size(), sbepp::buffer_pool::min_block_size());
+    ASSERT_EQ(medium.size(), 128u);
+    ASSERT_EQ(large.size(), sbepp::buffer_pool::max_block_size() + 1);
+}
+
+TEST(BufferPoolTest, ReusesReleasedBlocks)
+{
+    upstream_allocated = 0;
+    {
+        sbepp::buffer_pool pool{&counting_allocate, &counting_deallocate};
+
+        auto buf = pool.allocate(100);
+        const auto data = buf.data();
+        const auto allocated = upstream_allocated;
+        buf.reset();
+
+        ASSERT_TRUE(buf.empty());
+        ASSERT_EQ(buf.data(), nullptr);
+
+        buf = pool.allocate(128);
+
+        ASSERT_EQ(buf.data(), data);
+        ASSERT_EQ(upstream_allocated, allocated);
+        ASSERT_EQ(pool.statistics().hits, 1u);
+        ASSERT_EQ(pool.statistics().misses, 1u);
+
+        // different size class
+        const auto other = pool.allocate(129);
+
+        ASSERT_NE(other.data(), data);
+        ASSERT_EQ(pool.statistics().misses, 2u);
+    }
+    ASSERT_EQ(upstream_allocated, 0u);
+}
+
+TEST(BufferPoolTest, LargeBlocksAreNotCached)
+{
+    upstream_allocated = 0;
+    sbepp::buffer_pool pool{&counting_allocate, &counting_deallocate};
+
+    pool.allocate(sbepp::buffer_pool::max_block_size() + 1);
+
+    ASSERT_EQ(upstream_allocated, 0u);
+
+    pool.allocate(sbepp::buffer_pool::max_block_size() + 1);
+
+    ASSERT_EQ(pool.statistics().hits, 0u);
+    ASSERT_EQ(pool.statistics().misses, 2u);
+}
+
+TEST(BufferPoolTest, BlocksCanBeReleasedOnOtherThreads)
+{
+    sbepp::buffer_pool pool;
+    std::vector<sbepp::pooled_buffer> buffers;
+    std::vector<std::uint8_t*> pointers;
+    for(std::size_t i = 0; i != 3; i++)
+    {
+        buffers.push_back(pool.allocate(64));
+        pointers.push_back(buffers.back().data());
+    }
+
+    std::thread t{[&buffers]
+                  {
+                      buffers.clear();
+                  }};
+    t.join();
+
+    for(std::size_t i = 0; i != 3; i++)
+    {
+        const auto buf = pool.allocate(64);
+        ASSERT_NE(
+            std::find(pointers.begin(), pointers.end(), buf.data()),
+            pointers.end());
+    }
+    ASSERT_EQ(pool.statistics().hits, 3u);
+}
+
+TEST(BufferPoolTest, BuffersCanOutliveThePool)
+{
+    upstream_allocated = 0;
+    sbepp::pooled_buffer local_buf;
+    sbepp::pooled_buffer remote_buf;
+    {
+        sbepp::buffer_pool pool{&counting_allocate, &counting_deallocate};
+        local_buf = pool.allocate(64);
+        remote_buf = pool.allocate(100);
+        // cached blocks are freed by the pool
+        pool.allocate(200);
+    }
+
+    ASSERT_NE(upstream_allocated, 0u);
+
+    local_buf.reset();
+    std::thread t{[&remote_buf]
+                  {
+                      remote_buf.reset();
+                  }};
+    t.join();
+
+    ASSERT_EQ(upstream_allocated, 0u);
+}
+
+TEST(BufferPoolTest, LocalPoolBuffersCanBeReleasedAfterThreadExit)
+{
+    sbepp::pooled_buffer buf;
+    std::thread t{[&buf]
+                  {
+                      buf = sbepp::buffer_pool::local().allocate(64);
+                  }};
+    t.join();
+
+    // the pool of `t` is already destroyed
+    ASSERT_FALSE(buf.empty());
+    buf.data()[0] = 1;
+    buf.reset();
+
+    ASSERT_TRUE(buf.empty());
+}
+
+TEST(BufferPoolTest, EachThreadHasLocalPool)
+{
+    sbepp::buffer_pool* other{};
+    std::thread t{[&other]
+                  {
+                      other = &sbepp::buffer_pool::local();
+                  }};
+    t.join();
+
+    ASSERT_EQ(&sbepp::buffer_pool::local(), &sbepp::buffer_pool::local());
+    ASSERT_NE(&sbepp::buffer_pool::local(), other);
+}
+
+TEST(BufferPoolTest, MakeViewUsesWholeBuffer)
+{
+    const auto buf = sbepp::buffer_pool::local().allocate(
+        sbepp::message_traits<test_schema::schema::messages::msg28>::size_bytes(
+            2, 10));
+
+    const auto m = sbepp::make_view<test_schema::messages::msg28>(buf);
+
+    IS_SAME_TYPE(
+        decltype(m), const test_schema::messages::msg28<std::uint8_t>);
+    ASSERT_EQ(sbepp::addressof(m), buf.data());
+    sbepp::fill_message_header(m);
+    m.required(1);
+}
+} // namespace
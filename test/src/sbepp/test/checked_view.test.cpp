@@ -0,0 +1,319 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Oleksandr Koval
+
+#include <test_schema/messages/msg28.hpp>
+#include <test_schema/messages/msg3.hpp>
+
+#include <sbepp/test/utils.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <type_traits>
+
+namespace
+{
+using byte_type = std::uint8_t;
+using message_t = test_schema::messages::msg28<byte_type>;
+using message_tag = test_schema::schema::messages::msg28;
+using checked_message_t = sbepp::checked_view<message_t>;
+using group_t = decltype(std::declval<message_t>().group());
+using entry_t = group_t::value_type;
+using var_data_t = decltype(std::declval<message_t>().varData());
+using var_str_t = decltype(std::declval<message_t>().varStr());
+
+IS_SAME_TYPE(checked_message_t::view_type, message_t);
+IS_SAME_TYPE(checked_message_t::byte_type, byte_type);
+IS_SAME_TYPE(
+    decltype(sbepp::try_make_view<test_schema::messages::msg28>(
+        std::declval<byte_type*>(), 0)),
+    sbepp::access_result<checked_message_t>);
+IS_SAME_TYPE(
+    decltype(sbepp::try_make_const_view<test_schema::messages::msg28>(
+        std::declval<byte_type*>(), 0)),
+    sbepp::access_result<
+        sbepp::checked_view<test_schema::messages::msg28<const byte_type>>>);
+IS_SAME_TYPE(
+    decltype(std::declval<checked_message_t>()
+                 .try_get<message_tag::group>()),
+    sbepp::access_result<sbepp::checked_view<group_t>>);
+IS_SAME_TYPE(
+    decltype(std::declval<checked_message_t>()
+                 .try_get<message_tag::varStr>()),
+    sbepp::access_result<var_str_t>);
+IS_SAME_TYPE(
+    decltype(std::declval<sbepp::checked_view<group_t>>().try_at(0)),
+    sbepp::access_result<sbepp::checked_view<entry_t>>);
+
+STATIC_ASSERT_V(std::is_nothrow_constructible<sbepp::access_result<int>, int>);
+STATIC_ASSERT_V(std::is_nothrow_constructible<
+                sbepp::access_result<int>,
+                sbepp::access_error>);
+STATIC_ASSERT_V(
+    std::is_trivially_copy_constructible<sbepp::access_result<int>>);
+STATIC_ASSERT_V(std::is_nothrow_default_constructible<checked_message_t>);
+STATIC_ASSERT_V(std::is_trivially_copy_constructible<checked_message_t>);
+
+constexpr std::uint16_t num_in_group = 3;
+constexpr std::size_t var_data_size = 5;
+constexpr std::size_t var_str_size = 7;
+
+class CheckedViewTest : public ::testing::Test
+{
+public:
+    CheckedViewTest()
+    {
+        sbepp::fill_message_header(msg);
+        msg.required(1);
+        auto g = msg.group();
+        sbepp::fill_group_header(g, num_in_group);
+        std::uint32_t i{};
+        for(const auto entry : g)
+        {
+            entry.number(i);
+            i++;
+        }
+        msg.varData().resize(var_data_size);
+        msg.varStr().resize(var_str_size);
+        msg_size = sbepp::size_bytes(msg);
+    }
+
+    sbepp::access_result<checked_message_t>
+        make_checked(const std::size_t size)
+    {
+        return sbepp::try_make_view<test_schema::messages::msg28>(
+            buf.data(), size);
+    }
+
+    std::array<byte_type, 512> buf{};
+    message_t msg{buf.data(), buf.size()};
+    std::size_t msg_size{};
+};
+
+TEST_F(CheckedViewTest, AccessResultHoldsValueOrError)
+{
+    sbepp::access_result<int> value{1};
+    sbepp::access_result<int> error{sbepp::access_error::out_of_bounds};
+
+    ASSERT_TRUE(value.has_value());
+    ASSERT_TRUE(value);
+    ASSERT_EQ(value.value(), 1);
+    ASSERT_EQ(*value, 1);
+    ASSERT_EQ(value.value_or(2), 1);
+
+    ASSERT_FALSE(error.has_value());
+    ASSERT_FALSE(error);
+    ASSERT_EQ(error.error(), sbepp::access_error::out_of_bounds);
+    ASSERT_EQ(error.value_or(2), 2);
+}
+
+TEST_F(CheckedViewTest, TryMakeViewFailsOnNullBuffer)
+{
+    auto res = sbepp::try_make_view<test_schema::messages::msg28>(
+        static_cast<byte_type*>(nullptr), 0);
+
+    ASSERT_FALSE(res);
+    ASSERT_EQ(res.error(), sbepp::access_error::null_view);
+}
+
+TEST_F(CheckedViewTest, TryMakeViewValidatesHeaderAndBlock)
+{
+    const auto header_size = sbepp::size_bytes(sbepp::get_header(msg));
+    const auto block_length =
+        sbepp::message_traits<message_tag>::block_length();
+
+    ASSERT_FALSE(make_checked(header_size - 1));
+    ASSERT_FALSE(make_checked(header_size + block_length - 1));
+    ASSERT_EQ(
+        make_checked(header_size + block_length - 1).error(),
+        sbepp::access_error::out_of_bounds);
+
+    auto res = make_checked(header_size + block_length);
+
+    ASSERT_TRUE(res);
+    ASSERT_EQ(sbepp::addressof(res->view()), buf.data());
+    ASSERT_EQ(res->buffer_end(), buf.data() + header_size + block_length);
+    ASSERT_EQ(*res.value()->required(), 1u);
+}
+
+TEST_F(CheckedViewTest, TryMakeViewUsesLargestBlockLength)
+{
+    const auto header_size = sbepp::size_bytes(sbepp::get_header(msg));
+    const auto block_length =
+        sbepp::message_traits<message_tag>::block_length();
+    sbepp::get_header(msg).blockLength(block_length + 10);
+
+    ASSERT_FALSE(make_checked(header_size + block_length));
+    ASSERT_TRUE(make_checked(header_size + block_length + 10));
+}
+
+TEST_F(CheckedViewTest, TryGetReturnsMembers)
+{
+    auto m = make_checked(msg_size).value();
+    auto g = m.try_get<message_tag::group>();
+    auto var_data = m.try_get<message_tag::varData>();
+    auto var_str = m.try_get<message_tag::varStr>();
+
+    ASSERT_TRUE(g);
+    ASSERT_EQ(sbepp::addressof(g->view()), sbepp::addressof(msg.group()));
+    ASSERT_EQ(g->size(), num_in_group);
+    ASSERT_TRUE(var_data);
+    ASSERT_EQ(sbepp::addressof(*var_data), sbepp::addressof(msg.varData()));
+    ASSERT_EQ(var_data->size(), var_data_size);
+    ASSERT_TRUE(var_str);
+    ASSERT_EQ(sbepp::addressof(*var_str), sbepp::addressof(msg.varStr()));
+    ASSERT_EQ(var_str->size(), var_str_size);
+}
+
+TEST_F(CheckedViewTest, TryGetFailsIfMemberDoesNotFit)
+{
+    auto m = make_checked(msg_size - 1).value();
+
+    ASSERT_TRUE(m.try_get<message_tag::group>());
+    ASSERT_TRUE(m.try_get<message_tag::varData>());
+    ASSERT_EQ(
+        m.try_get<message_tag::varStr>().error(),
+        sbepp::access_error::out_of_bounds);
+}
+
+TEST_F(CheckedViewTest, TryGetFailsIfPrecedingMemberDoesNotFit)
+{
+    const auto group_end = sbepp::addressof(msg.group())
+                           + sbepp::size_bytes(msg.group()) - buf.data();
+    auto m = make_checked(group_end - 1).value();
+
+    ASSERT_TRUE(m.try_get<message_tag::group>());
+    ASSERT_FALSE(m.try_get<message_tag::varData>());
+    ASSERT_FALSE(m.try_get<message_tag::varStr>());
+}
+
+TEST_F(CheckedViewTest, TryGetFailsIfLengthPrefixDoesNotFit)
+{
+    const auto var_data_begin =
+        sbepp::addressof(msg.varData()) - buf.data();
+    auto m = make_checked(var_data_begin + 1).value();
+
+    ASSERT_FALSE(m.try_get<message_tag::varData>());
+}
+
+TEST_F(CheckedViewTest, TryGetFailsIfTruncatedInsideGroupHeader)
+{
+    const auto group_begin = sbepp::addressof(msg.group()) - buf.data();
+    auto m = make_checked(group_begin + 1).value();
+
+    ASSERT_FALSE(m.try_get<message_tag::group>());
+    ASSERT_FALSE(m.try_get<message_tag::varData>());
+    ASSERT_FALSE(m.try_get<message_tag::varStr>());
+    ASSERT_FALSE(sbepp::size_bytes_checked(msg, group_begin + 1).valid);
+}
+
+TEST_F(CheckedViewTest, TryGetFailsIfTruncatedInsideDataLengthPrefix)
+{
+    const auto var_data_begin =
+        sbepp::addressof(msg.varData()) - buf.data();
+    auto m = make_checked(var_data_begin + 1).value();
+
+    ASSERT_TRUE(m.try_get<message_tag::group>());
+    ASSERT_FALSE(m.try_get<message_tag::varStr>());
+    ASSERT_FALSE(sbepp::size_bytes_checked(msg, var_data_begin + 1).valid);
+}
+
+TEST_F(CheckedViewTest, TryAtReturnsEntries)
+{
+    auto g = make_checked(msg_size).value().try_get<message_tag::group>();
+
+    for(std::size_t i = 0; i != num_in_group; i++)
+    {
+        auto entry = g->try_at(i);
+
+        ASSERT_TRUE(entry);
+        ASSERT_EQ(
+            sbepp::addressof(entry->view()),
+            sbepp::addressof(msg.group()[i]));
+        ASSERT_EQ(*entry.value()->number(), i);
+    }
+    ASSERT_FALSE(g->try_at(num_in_group));
+}
+
+TEST_F(CheckedViewTest, TryAtFailsIfEntryDoesNotFit)
+{
+    const auto last_entry_end =
+        sbepp::addressof(msg.group()[num_in_group - 1]) - buf.data()
+        + sbepp::group_traits<message_tag::group>::block_length();
+    auto g =
+        make_checked(last_entry_end - 1).value().try_get<message_tag::group>();
+
+    ASSERT_TRUE(g);
+    ASSERT_TRUE(g->try_at(num_in_group - 2));
+    ASSERT_EQ(
+        g->try_at(num_in_group - 1).error(),
+        sbepp::access_error::out_of_bounds);
+}
+
+using nested_message_t = test_schema::messages::msg3<byte_type>;
+using nested_message_tag = test_schema::schema::messages::msg3;
+
+class CheckedViewNestedGroupTest : public ::testing::Test
+{
+public:
+    CheckedViewNestedGroupTest()
+    {
+        sbepp::fill_message_header(msg);
+        auto g = msg.nested_group();
+        sbepp::fill_group_header(g, num_in_group);
+        std::uint32_t i{};
+        for(const auto entry : g)
+        {
+            entry.number(i);
+            sbepp::fill_group_header(entry.flat_group(), i);
+            entry.data().resize(i * 3);
+            i++;
+        }
+    }
+
+    std::array<byte_type, 512> buf{};
+    nested_message_t msg{buf.data(), buf.size()};
+};
+
+TEST_F(CheckedViewNestedGroupTest, TryAtWalksPrecedingEntries)
+{
+    const auto size = sbepp::size_bytes(msg);
+    auto g = sbepp::try_make_view<test_schema::messages::msg3>(
+                 buf.data(), size)
+                 .value()
+                 .try_get<nested_message_tag::nested_group>();
+    std::size_t i{};
+
+    ASSERT_TRUE(g);
+    for(const auto entry : msg.nested_group())
+    {
+        auto checked_entry = g->try_at(i);
+
+        ASSERT_TRUE(checked_entry);
+        ASSERT_EQ(
+            sbepp::addressof(checked_entry->view()), sbepp::addressof(entry));
+        ASSERT_EQ(*checked_entry.value()->number(), i);
+
+        auto data = checked_entry->try_get<
+            nested_message_tag::nested_group::data>();
+        ASSERT_TRUE(data);
+        ASSERT_EQ(data->size(), i * 3);
+        i++;
+    }
+}
+
+TEST_F(CheckedViewNestedGroupTest, TryAtFailsIfPrecedingEntryDoesNotFit)
+{
+    auto last_entry = *std::next(msg.nested_group().begin(), num_in_group - 1);
+    const auto size = sbepp::addressof(last_entry) - buf.data() - 1;
+    auto g = sbepp::try_make_view<test_schema::messages::msg3>(
+                 buf.data(), size)
+                 .value()
+                 .try_get<nested_message_tag::nested_group>();
+
+    ASSERT_TRUE(g);
+    ASSERT_TRUE(g->try_at(0));
+    ASSERT_FALSE(g->try_at(num_in_group - 1));
+}
+} // namespace
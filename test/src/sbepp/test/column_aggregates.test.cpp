@@ -0,0 +1,130 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Oleksandr Koval
+
+#include <big_endian_schema/big_endian_schema.hpp>
+
+#include <sbepp/test/utils.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+
+namespace
+{
+using group_tag = big_endian_schema::schema::messages::msg2::group;
+
+IS_SAME_TYPE(sbepp::column_sum_t<group_tag::price>, std::int64_t);
+IS_SAME_TYPE(sbepp::column_sum_t<group_tag::quantity>, std::uint64_t);
+IS_SAME_TYPE(sbepp::column_sum_t<group_tag::optional>, std::int64_t);
+IS_SAME_TYPE(sbepp::column_sum_t<group_tag::ratio>, double);
+
+class ColumnAggregatesTest : public ::testing::Test
+{
+public:
+    std::array<std::uint8_t, 512> buf{};
+    big_endian_schema::messages::msg2<std::uint8_t> m{buf.data(), buf.size()};
+
+    // prices: 30, -10, 20, -10, 50
+    // quantities: 1, 2, 3, 4, 5
+    // optional: null, -5, null, 7, 100
+    void SetUp() override
+    {
+        sbepp::fill_message_header(m);
+        auto g = m.group();
+        sbepp::fill_group_header(g, 5);
+        const std::array<std::int64_t, 5> prices{30, -10, 20, -10, 50};
+        const std::array<std::int32_t, 5> optionals{0, -5, 0, 7, 100};
+        for(std::uint32_t i = 0; i != 5; i++)
+        {
+            g[i].price(prices[i]);
+            g[i].quantity(i + 1);
+            g[i].ratio(i * 0.5);
+            if(i % 2 || i == 4)
+            {
+                g[i].optional(optionals[i]);
+            }
+            else
+            {
+                g[i].optional(sbepp::nullopt);
+            }
+        }
+    }
+};
+
+TEST_F(ColumnAggregatesTest, SumSkipsNullValues)
+{
+    ASSERT_EQ(sbepp::column_sum<group_tag::price>(m.group()), 80);
+    ASSERT_EQ(sbepp::column_sum<group_tag::quantity>(m.group()), 15u);
+    ASSERT_EQ(sbepp::column_sum<group_tag::optional>(m.group()), 102);
+    ASSERT_DOUBLE_EQ(sbepp::column_sum<group_tag::ratio>(m.group()), 5.0);
+}
+
+TEST_F(ColumnAggregatesTest, MinMaxReturnFirstExtremum)
+{
+    ASSERT_EQ(sbepp::column_argmin<group_tag::price>(m.group()), 1u);
+    ASSERT_EQ(sbepp::column_argmax<group_tag::price>(m.group()), 4u);
+    ASSERT_EQ(sbepp::column_min<group_tag::price>(m.group()), -10);
+    ASSERT_EQ(sbepp::column_max<group_tag::price>(m.group()), 50);
+    ASSERT_EQ(sbepp::column_argmin<group_tag::optional>(m.group()), 1u);
+    ASSERT_EQ(sbepp::column_max<group_tag::optional>(m.group()), 100);
+}
+
+TEST_F(ColumnAggregatesTest, MinMaxSkipNullValues)
+{
+    // the first entry is null and its raw value is less than others
+    ASSERT_EQ(sbepp::column_min<group_tag::optional>(m.group()), -5);
+    ASSERT_EQ(sbepp::column_argmax<group_tag::optional>(m.group()), 4u);
+    ASSERT_DOUBLE_EQ(sbepp::column_min<group_tag::ratio>(m.group()), 0.0);
+    ASSERT_DOUBLE_EQ(sbepp::column_max<group_tag::ratio>(m.group()), 2.0);
+}
+
+TEST_F(ColumnAggregatesTest, CountsNullValues)
+{
+    ASSERT_EQ(sbepp::column_count_null<group_tag::optional>(m.group()), 2u);
+}
+
+TEST_F(ColumnAggregatesTest, FilterWritesMatchingIndexes)
+{
+    std::array<std::size_t, 5> indexes{};
+
+    auto count = sbepp::column_filter<group_tag::price>(
+        m.group(),
+        [](const std::int64_t price)
+        {
+            return price > 0;
+        },
+        indexes.data(),
+        indexes.size());
+
+    ASSERT_EQ(count, 3u);
+    ASSERT_EQ(indexes[0], 0u);
+    ASSERT_EQ(indexes[1], 2u);
+    ASSERT_EQ(indexes[2], 4u);
+
+    count = sbepp::column_filter<group_tag::optional>(
+        m.group(),
+        [](const std::int32_t)
+        {
+            return true;
+        },
+        indexes.data(),
+        2);
+
+    ASSERT_EQ(count, 2u);
+    ASSERT_EQ(indexes[0], 1u);
+    ASSERT_EQ(indexes[1], 3u);
+}
+
+TEST(ColumnAggregatesEmptyTest, ArgminOfEmptyGroupIsSize)
+{
+    std::array<std::uint8_t, 64> buf{};
+    auto m = sbepp::make_view<big_endian_schema::messages::msg2>(
+        buf.data(), buf.size());
+    sbepp::fill_message_header(m);
+    sbepp::fill_group_header(m.group(), 0);
+
+    ASSERT_EQ(sbepp::column_argmin<group_tag::price>(m.group()), 0u);
+    ASSERT_EQ(sbepp::column_sum<group_tag::price>(m.group()), 0);
+}
+} // namespace
@@ -0,0 +1,192 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Oleksandr Koval
+
+#include <test_schema/test_schema.hpp>
+#include <traits_test_schema2/schema/schema.hpp>
+
+#include <sbepp/test/utils.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+
+namespace
+{
+using byte_type = std::uint8_t;
+using schema_tag = test_schema::schema;
+using schema_traits = sbepp::schema_traits<schema_tag>;
+using msg4_tag = test_schema::schema::messages::msg4;
+using msg5_tag = test_schema::schema::messages::msg5;
+
+struct visitor_t
+{
+    void operator()(test_schema::messages::msg4<byte_type> m)
+    {
+        msg4_ptr = sbepp::addressof(m);
+    }
+
+    template<typename Message>
+    void operator()(Message)
+    {
+        other_count++;
+    }
+
+    byte_type* msg4_ptr{};
+    std::size_t other_count{};
+};
+
+struct const_visitor_t
+{
+    void operator()(test_schema::messages::msg5<const byte_type>)
+    {
+        msg5_count++;
+    }
+
+    template<typename Message>
+    void operator()(Message)
+    {
+    }
+
+    std::size_t msg5_count{};
+};
+
+class DispatchTest : public ::testing::Test
+{
+public:
+    DispatchTest()
+    {
+        sbepp::fill_message_header(msg);
+    }
+
+    std::array<byte_type, 512> buf{};
+    test_schema::messages::msg4<byte_type> msg{buf.data(), buf.size()};
+    visitor_t visitor;
+};
+
+TEST_F(DispatchTest, CallsVisitorWithMessageView)
+{
+    const auto res =
+        sbepp::dispatch<schema_tag>(buf.data(), buf.size(), visitor);
+
+    ASSERT_EQ(res, sbepp::dispatch_result::dispatched);
+    ASSERT_EQ(visitor.msg4_ptr, buf.data());
+    ASSERT_EQ(visitor.other_count, 0u);
+
+    sbepp::get_header(msg).templateId(sbepp::message_traits<msg5_tag>::id());
+
+    ASSERT_EQ(
+        sbepp::dispatch<schema_tag>(buf.data(), buf.size(), visitor),
+        sbepp::dispatch_result::dispatched);
+    ASSERT_EQ(visitor.other_count, 1u);
+}
+
+TEST_F(DispatchTest, PreservesByteConstness)
+{
+    const_visitor_t const_visitor;
+    sbepp::get_header(msg).templateId(sbepp::message_traits<msg5_tag>::id());
+    const auto* data = buf.data();
+
+    sbepp::dispatch<schema_tag>(data, buf.size(), const_visitor);
+
+    ASSERT_EQ(const_visitor.msg5_count, 1u);
+}
+
+TEST_F(DispatchTest, AcceptsTemporaryVisitor)
+{
+    ASSERT_EQ(
+        sbepp::dispatch<schema_tag>(buf.data(), buf.size(), visitor_t{}),
+        sbepp::dispatch_result::dispatched);
+}
+
+TEST_F(DispatchTest, ReturnsErrorForUnknownTemplateId)
+{
+    sbepp::get_header(msg).templateId(1000);
+
+    const auto res =
+        sbepp::dispatch<schema_tag>(buf.data(), buf.size(), visitor);
+
+    ASSERT_EQ(res, sbepp::dispatch_result::unknown_template_id);
+    ASSERT_EQ(visitor.msg4_ptr, nullptr);
+    ASSERT_EQ(visitor.other_count, 0u);
+}
+
+TEST_F(DispatchTest, ReturnsErrorForIncompleteHeader)
+{
+    const auto header_size = sbepp::size_bytes(sbepp::get_header(msg));
+
+    ASSERT_EQ(
+        sbepp::dispatch<schema_tag>(buf.data(), header_size - 1, visitor),
+        sbepp::dispatch_result::incomplete_header);
+    ASSERT_EQ(
+        sbepp::dispatch<schema_tag>(
+            static_cast<byte_type*>(nullptr), 0, visitor),
+        sbepp::dispatch_result::incomplete_header);
+    ASSERT_EQ(visitor.msg4_ptr, nullptr);
+    ASSERT_EQ(visitor.other_count, 0u);
+}
+
+TEST_F(DispatchTest, ChecksSchemaIdOnlyIfRequested)
+{
+    sbepp::get_header(msg).schemaId(schema_traits::id() + 1);
+
+    ASSERT_EQ(
+        sbepp::dispatch<schema_tag>(buf.data(), buf.size(), visitor),
+        sbepp::dispatch_result::dispatched);
+    ASSERT_EQ(
+        sbepp::dispatch<schema_tag>(
+            buf.data(), buf.size(), visitor, {true, false}),
+        sbepp::dispatch_result::wrong_schema_id);
+
+    sbepp::get_header(msg).schemaId(schema_traits::id());
+
+    ASSERT_EQ(
+        sbepp::dispatch<schema_tag>(
+            buf.data(), buf.size(), visitor, {true, false}),
+        sbepp::dispatch_result::dispatched);
+}
+
+TEST_F(DispatchTest, ChecksVersionOnlyIfRequested)
+{
+    sbepp::get_header(msg).version(schema_traits::version() + 1);
+
+    ASSERT_EQ(
+        sbepp::dispatch<schema_tag>(buf.data(), buf.size(), visitor),
+        sbepp::dispatch_result::dispatched);
+    ASSERT_EQ(
+        sbepp::dispatch<schema_tag>(
+            buf.data(), buf.size(), visitor, {false, true}),
+        sbepp::dispatch_result::unsupported_version);
+
+    sbepp::get_header(msg).version(schema_traits::version());
+
+    ASSERT_EQ(
+        sbepp::dispatch<schema_tag>(
+            buf.data(), buf.size(), visitor, {false, true}),
+        sbepp::dispatch_result::dispatched);
+}
+
+TEST(SchemaTraitsDispatchTest, ReturnsFalseForUnknownTemplateId)
+{
+    std::array<byte_type, 64> buf{};
+    visitor_t visitor;
+
+    ASSERT_TRUE(schema_traits::dispatch(
+        sbepp::message_traits<msg4_tag>::id(),
+        buf.data(),
+        buf.size(),
+        visitor));
+    ASSERT_FALSE(
+        schema_traits::dispatch(1000, buf.data(), buf.size(), visitor));
+}
+
+TEST(SchemaTraitsDispatchTest, ReturnsFalseIfSchemaHasNoMessages)
+{
+    using traits = sbepp::schema_traits<traits_test_schema2::schema>;
+    std::array<byte_type, 64> buf{};
+    visitor_t visitor;
+
+    ASSERT_FALSE(traits::dispatch(1, buf.data(), buf.size(), visitor));
+    ASSERT_EQ(visitor.other_count, 0u);
+}
+} // namespace
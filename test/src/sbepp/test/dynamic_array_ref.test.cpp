@@ -1128,6 +1128,38 @@ TEST_F(DynamicArrayRefDeathTest, AssignRangeTerminatesIfRangeIsTooLong)
     ASSERT_DEATH({ a.assign_range(range); }, ".*");
 }
 
+TEST_F(DynamicArrayRefTest, CopyToCopiesAllElements)
+{
+    const std::string str{"abc"};
+    a.assign_string(str.c_str());
+    std::array<char, 3> values{};
+
+    const auto res = a.copy_to(values.data());
+
+    ASSERT_EQ(res, values.data() + values.size());
+    ASSERT_EQ(std::string(values.data(), values.size()), str);
+}
+
+TEST_F(DynamicArrayRefTest, AssignFromReplacesContent)
+{
+    a.assign_string("abcdef");
+    const std::array<char, 3> values{'x', 'y', 'z'};
+
+    a.assign_from(values.data(), values.size());
+
+    ASSERT_EQ(a.size(), values.size());
+    ASSERT_TRUE(std::equal(a.begin(), a.end(), values.begin()));
+    STATIC_ASSERT(noexcept(a.assign_from(values.data(), values.size())));
+}
+
+TEST_F(DynamicArrayRefDeathTest, AssignFromTerminatesIfCountIsTooBig)
+{
+    std::vector<char> values;
+    values.resize(buf.size());
+
+    ASSERT_DEATH({ a.assign_from(values.data(), values.size()); }, ".*");
+}
+
 #if SBEPP_HAS_CONSTEXPR_ACCESSORS
 constexpr auto constexpr_test()
 {
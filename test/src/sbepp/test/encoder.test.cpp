@@ -0,0 +1,173 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Oleksandr Koval
+
+#include <test_schema/test_schema.hpp>
+
+#include <sbepp/test/utils.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace
+{
+using byte_type = std::uint8_t;
+using msg28_tags = test_schema::schema::messages::msg28;
+using msg29_tags = test_schema::schema::messages::msg29;
+using message_t = test_schema::messages::msg28<byte_type>;
+using encoder_t = sbepp::message_encoder<message_t>;
+using group_encoder_t = encoder_t::group_encoder_t<msg28_tags::group>;
+
+IS_SAME_TYPE(
+    decltype(sbepp::make_encoder(std::declval<message_t>())), encoder_t);
+IS_SAME_TYPE(encoder_t::view_type, message_t);
+IS_SAME_TYPE(group_encoder_t::group_type, decltype(message_t{}.group()));
+STATIC_ASSERT_V(std::is_nothrow_default_constructible<encoder_t>);
+STATIC_ASSERT_V(std::is_trivially_copy_constructible<group_encoder_t>);
+STATIC_ASSERT_V(!std::is_copy_constructible<encoder_t>);
+STATIC_ASSERT_V(!std::is_copy_assignable<encoder_t>);
+STATIC_ASSERT_V(std::is_nothrow_move_constructible<encoder_t>);
+STATIC_ASSERT_V(std::is_nothrow_move_assignable<encoder_t>);
+
+class EncoderTest : public ::testing::Test
+{
+public:
+    std::array<byte_type, 512> buf{};
+};
+
+TEST_F(EncoderTest, FillsMessageHeader)
+{
+    auto enc = sbepp::make_encoder(
+        sbepp::make_view<test_schema::messages::msg28>(buf.data(), buf.size()));
+    const auto header = sbepp::get_header(enc.view());
+
+    ASSERT_EQ(
+        *header.templateId(),
+        sbepp::message_traits<msg28_tags>::id());
+    ASSERT_EQ(
+        *header.blockLength(),
+        sbepp::message_traits<msg28_tags>::block_length());
+}
+
+TEST_F(EncoderTest, TracksMessageSize)
+{
+    auto enc = sbepp::make_encoder(
+        sbepp::make_view<test_schema::messages::msg28>(buf.data(), buf.size()));
+    auto m = enc.view();
+
+    ASSERT_EQ(
+        enc.size(),
+        sbepp::size_bytes(sbepp::get_header(m))
+            + sbepp::message_traits<msg28_tags>::block_length());
+
+    // fields can be set in any order
+    enc.set<msg28_tags::optional2>(2).set<msg28_tags::required>(1);
+    auto g = enc.group<msg28_tags::group>();
+    for(std::uint32_t i = 0; i != 3; i++)
+    {
+        g.emplace_back().set<msg28_tags::group::number>(i);
+    }
+    const std::array<byte_type, 2> data{1, 2};
+    enc.assign_range<msg28_tags::varData>(data).assign_string<
+        msg28_tags::varStr>("abc");
+
+    ASSERT_EQ(enc.size(), sbepp::size_bytes(m));
+    ASSERT_EQ(*m.required(), 1u);
+    ASSERT_EQ(*m.optional2(), 2u);
+    ASSERT_EQ(g.size(), 3u);
+    ASSERT_EQ(m.group().size(), 3u);
+    ASSERT_EQ(*m.group()[2].number(), 2u);
+    ASSERT_EQ(m.varData().size(), 2u);
+    ASSERT_EQ(
+        std::string(m.varStr().data(), m.varStr().size()), std::string{"abc"});
+}
+
+TEST_F(EncoderTest, EmptyGroupsAreEncodedAsHeaderOnly)
+{
+    auto enc = sbepp::make_encoder(
+        sbepp::make_view<test_schema::messages::msg28>(buf.data(), buf.size()));
+    auto m = enc.view();
+
+    const auto g = enc.group<msg28_tags::group>();
+    enc.assign_string<msg28_tags::varData>("")
+        .assign_string<msg28_tags::varStr>("");
+
+    ASSERT_EQ(g.size(), 0u);
+    ASSERT_EQ(enc.size(), sbepp::size_bytes(m));
+    ASSERT_EQ(
+        enc.size(),
+        sbepp::message_traits<msg28_tags>::size_bytes(0, 0));
+}
+
+TEST_F(EncoderTest, EncodesNestedGroups)
+{
+    auto enc = sbepp::make_encoder(
+        sbepp::make_view<test_schema::messages::msg29>(buf.data(), buf.size()));
+    auto m = enc.view();
+
+    enc.set<msg29_tags::number>(1);
+    enc.group<msg29_tags::first_group>().emplace_back();
+    auto g = enc.group<msg29_tags::group>();
+    for(std::uint32_t i = 0; i != 2; i++)
+    {
+        auto e = g.emplace_back();
+        e.set<msg29_tags::group::number>(i + 10);
+        auto nested = e.group<msg29_tags::group::first_group>();
+        nested.emplace_back();
+        nested.emplace_back();
+        e.group<msg29_tags::group::group>();
+        e.assign_string<msg29_tags::group::data>("xy");
+    }
+    enc.assign_string<msg29_tags::data>("z");
+
+    ASSERT_EQ(enc.size(), sbepp::size_bytes(m));
+    ASSERT_EQ(m.first_group().size(), 1u);
+    ASSERT_EQ(m.group().size(), 2u);
+    auto it = m.group().begin();
+    ++it;
+    const auto e = *it;
+    ASSERT_EQ(*e.number(), 11u);
+    ASSERT_EQ(e.first_group().size(), 2u);
+    ASSERT_EQ(e.group().size(), 0u);
+    ASSERT_EQ(e.data().size(), 2u);
+    ASSERT_EQ(m.data().size(), 1u);
+}
+
+TEST_F(EncoderTest, MoveTransfersEncoding)
+{
+    auto enc = sbepp::make_encoder(
+        sbepp::make_view<test_schema::messages::msg28>(buf.data(), buf.size()));
+    auto m = enc.view();
+    enc.set<msg28_tags::required>(1);
+
+    auto moved = std::move(enc);
+    moved.group<msg28_tags::group>().emplace_back();
+    moved.assign_string<msg28_tags::varData>("a")
+        .assign_string<msg28_tags::varStr>("bc");
+
+    ASSERT_EQ(moved.size(), sbepp::size_bytes(m));
+    ASSERT_EQ(sbepp::addressof(moved.view()), sbepp::addressof(m));
+    ASSERT_EQ(m.group().size(), 1u);
+    ASSERT_EQ(m.varStr().size(), 2u);
+}
+
+#if SBEPP_SIZE_CHECKS_ENABLED
+using EncoderDeathTest = EncoderTest;
+
+TEST_F(EncoderDeathTest, TerminatesIfGroupEncoderOutlivesMove)
+{
+    auto enc = sbepp::make_encoder(
+        sbepp::make_view<test_schema::messages::msg28>(buf.data(), buf.size()));
+    auto g = enc.group<msg28_tags::group>();
+    auto moved = std::move(enc);
+    (void)moved;
+
+    ASSERT_DEATH({ g.emplace_back(); }, ".*");
+    ASSERT_DEATH({ enc.assign_string<msg28_tags::varData>(""); }, ".*");
+}
+#endif
+} // namespace
@@ -0,0 +1,122 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Oleksandr Koval
+
+#include <test_schema/test_schema.hpp>
+#include <big_endian_schema/big_endian_schema.hpp>
+
+#include <sbepp/test/utils.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace
+{
+using msg14_group_tag = test_schema::schema::messages::msg14::group;
+using msg15_group_tag = test_schema::schema::messages::msg15::group;
+using msg17_group_tag = test_schema::schema::messages::msg17::group;
+using be_group_tag = big_endian_schema::schema::messages::msg2::group;
+
+IS_SAME_TYPE(
+    sbepp::column_value_t<msg14_group_tag::first_field>, std::uint32_t);
+IS_SAME_TYPE(
+    sbepp::column_value_t<msg15_group_tag::first_field>,
+    test_schema::types::numbers_enum);
+IS_SAME_TYPE(
+    sbepp::column_value_t<msg17_group_tag::first_field>, std::uint32_t);
+IS_SAME_TYPE(sbepp::column_value_t<be_group_tag::price>, std::int64_t);
+
+constexpr std::uint32_t entry_count = 5;
+
+class ExtractColumnTest : public ::testing::Test
+{
+public:
+    std::array<std::uint8_t, 256> buf{};
+    test_schema::messages::msg14<std::uint8_t> m{buf.data(), buf.size()};
+
+    void SetUp() override
+    {
+        sbepp::fill_message_header(m);
+        auto g = m.group();
+        sbepp::fill_group_header(g, entry_count);
+        for(std::uint32_t i = 0; i != entry_count; i++)
+        {
+            g[i].first_field(i);
+            g[i].second_field(i * 10);
+        }
+    }
+};
+
+TEST_F(ExtractColumnTest, CopiesFieldOfAllEntries)
+{
+    std::vector<std::uint32_t> values(entry_count);
+
+    const auto count = sbepp::extract_column<msg14_group_tag::second_field>(
+        m.group(), values.data(), values.size());
+
+    ASSERT_EQ(count, entry_count);
+    ASSERT_EQ(values, (std::vector<std::uint32_t>{0, 10, 20, 30, 40}));
+}
+
+TEST_F(ExtractColumnTest, CopiesNoMoreThanOutputSize)
+{
+    std::vector<std::uint32_t> values(2);
+
+    const auto count = sbepp::extract_column<msg14_group_tag::first_field>(
+        m.group(), values.data(), values.size());
+
+    ASSERT_EQ(count, 2u);
+    ASSERT_EQ(values, (std::vector<std::uint32_t>{0, 1}));
+}
+
+TEST_F(ExtractColumnTest, ExtractsMultipleFieldsInSinglePass)
+{
+    std::vector<std::uint32_t> first(entry_count);
+    std::vector<std::uint32_t> second(entry_count);
+
+    const auto count = sbepp::extract_columns<
+        msg14_group_tag::first_field,
+        msg14_group_tag::second_field>(
+        m.group(), entry_count, first.data(), second.data());
+
+    ASSERT_EQ(count, entry_count);
+    ASSERT_EQ(first, (std::vector<std::uint32_t>{0, 1, 2, 3, 4}));
+    ASSERT_EQ(second, (std::vector<std::uint32_t>{0, 10, 20, 30, 40}));
+}
+
+TEST(ExtractColumnBigEndianTest, ConvertsToNativeEndianness)
+{
+    std::array<std::uint8_t, 256> buf{};
+    auto m = sbepp::make_view<big_endian_schema::messages::msg2>(
+        buf.data(), buf.size());
+    sbepp::fill_message_header(m);
+    auto g = m.group();
+    sbepp::fill_group_header(g, 3);
+    for(std::uint32_t i = 0; i != 3; i++)
+    {
+        g[i].price(-static_cast<std::int64_t>(i) * 0x10000000000);
+        g[i].quantity(i + 0x01020300);
+        g[i].number(big_endian_schema::types::numbers_enum::Two);
+    }
+    std::array<std::int64_t, 3> prices{};
+    std::array<std::uint32_t, 3> quantities{};
+    std::array<big_endian_schema::types::numbers_enum, 3> numbers{};
+
+    const auto count = sbepp::extract_columns<
+        be_group_tag::price,
+        be_group_tag::quantity,
+        be_group_tag::number>(
+        g, 3, prices.data(), quantities.data(), numbers.data());
+
+    ASSERT_EQ(count, 3u);
+    ASSERT_EQ(
+        prices,
+        (std::array<std::int64_t, 3>{0, -0x10000000000, -0x20000000000}));
+    ASSERT_EQ(
+        quantities,
+        (std::array<std::uint32_t, 3>{0x01020300, 0x01020301, 0x01020302}));
+    ASSERT_EQ(numbers[2], big_endian_schema::types::numbers_enum::Two);
+}
+} // namespace
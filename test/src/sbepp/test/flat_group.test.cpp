@@ -296,6 +296,50 @@ TEST_F(FlatGroupTest, ClearSetsSizeToZero)
     STATIC_ASSERT(noexcept(g.clear()));
 }
 
+TEST_F(FlatGroupTest, InsertShiftsFollowingEntriesAndTail)
+{
+    sbepp::fill_group_header(g, 2);
+    g[0].number(1);
+    g[1].number(2);
+    auto tail = sbepp::addressof(g) + sbepp::size_bytes(g);
+    *tail = 0xAA;
+
+    auto it = g.insert(g.begin() + 1, 2, tail + 1);
+
+    ASSERT_EQ(it, g.begin() + 1);
+    ASSERT_EQ(g.size(), 4);
+    ASSERT_EQ(g[0].number(), 1);
+    ASSERT_EQ(g[1].number(), 0);
+    ASSERT_EQ(g[2].number(), 0);
+    ASSERT_EQ(g[3].number(), 2);
+    ASSERT_EQ(*(sbepp::addressof(g) + sbepp::size_bytes(g)), 0xAA);
+    STATIC_ASSERT(noexcept(g.insert(g.begin(), 1, tail)));
+}
+
+TEST_F(FlatGroupTest, EraseShiftsFollowingEntriesAndTail)
+{
+    sbepp::fill_group_header(g, 4);
+    for(std::size_t i = 0; i != g.size(); i++)
+    {
+        g[i].number(static_cast<std::uint32_t>(i));
+    }
+    auto tail = sbepp::addressof(g) + sbepp::size_bytes(g);
+    *tail = 0xAA;
+
+    auto it = g.erase(g.begin() + 1, g.begin() + 3, tail + 1);
+
+    ASSERT_EQ(it, g.begin() + 1);
+    ASSERT_EQ(g.size(), 2);
+    ASSERT_EQ(g[0].number(), 0);
+    ASSERT_EQ(g[1].number(), 3);
+    ASSERT_EQ(*(sbepp::addressof(g) + sbepp::size_bytes(g)), 0xAA);
+
+    g.erase(g.begin(), g.end(), tail + 1);
+
+    ASSERT_TRUE(g.empty());
+    ASSERT_EQ(*(sbepp::addressof(g) + sbepp::size_bytes(g)), 0xAA);
+}
+
 TEST_F(FlatGroupTest, BeginEndRepresentsEntriesWithinCurrentSize)
 {
     ASSERT_EQ(g.size(), 0);
@@ -376,6 +420,8 @@ constexpr auto constexpr_test()
     g3[0];
     g3.front();
     g3.back();
+    g3.insert(g3.begin(), 1, buf.data() + sbepp::size_bytes(g3));
+    g3.erase(g3.begin(), g3.end(), buf.data() + sbepp::size_bytes(g3));
     g3.clear();
 
     sbepp::addressof(g3);
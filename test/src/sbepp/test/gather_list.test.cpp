@@ -0,0 +1,144 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Oleksandr Koval
+
+#include <test_schema/test_schema.hpp>
+
+#include <sbepp/test/utils.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace
+{
+using msg28_tag = test_schema::schema::messages::msg28;
+
+STATIC_ASSERT(sbepp::gather_list<2>::max_segments() == 5);
+
+class GatherListTest : public ::testing::Test
+{
+public:
+    std::array<std::uint8_t, 256> buf{};
+    std::array<std::uint8_t, 256> expected_buf{};
+    std::vector<std::uint8_t> var_data{1, 2, 3};
+    std::string var_str{"abcd"};
+    sbepp::gather_list<2> io;
+
+    template<typename Message>
+    void encode_fixed(Message m)
+    {
+        sbepp::fill_message_header(m);
+        m.required(1);
+        auto g = m.group();
+        sbepp::fill_group_header(g, 2);
+        g[0].number(2);
+        g[1].number(3);
+    }
+
+    std::size_t encode_expected()
+    {
+        auto m = sbepp::make_view<test_schema::messages::msg28>(
+            expected_buf.data(), expected_buf.size());
+        encode_fixed(m);
+        m.varData().assign_range(var_data);
+        m.varStr().assign_string(var_str.c_str());
+        return sbepp::size_bytes(m);
+    }
+
+    std::vector<std::uint8_t> gather() const
+    {
+        std::vector<std::uint8_t> res;
+        for(const auto& segment : io)
+        {
+            auto first = static_cast<const std::uint8_t*>(segment.iov_base);
+            res.insert(res.end(), first, first + segment.iov_len);
+        }
+        return res;
+    }
+};
+
+TEST_F(GatherListTest, ProducesSameBytesAsContiguousEncoding)
+{
+    const auto expected_size = encode_expected();
+    auto m = sbepp::make_view<test_schema::messages::msg28>(
+        buf.data(), buf.size());
+    encode_fixed(m);
+
+    io.add_external(m.varData(), var_data.data(), var_data.size());
+    io.add_external(m.varStr(), var_str.data(), var_str.size());
+    const auto buffer_size = sbepp::size_bytes(m);
+    io.finish(m);
+
+    ASSERT_EQ(io.external_count(), 2u);
+    ASSERT_EQ(io.size(), 4u);
+    ASSERT_EQ(io.data()[1].iov_base, var_data.data());
+    ASSERT_EQ(io.data()[3].iov_base, var_str.data());
+    ASSERT_EQ(buffer_size, expected_size - var_data.size() - var_str.size());
+    ASSERT_EQ(io.size_bytes(), expected_size);
+    ASSERT_EQ(
+        gather(),
+        std::vector<std::uint8_t>(
+            expected_buf.begin(), expected_buf.begin() + expected_size));
+}
+
+TEST_F(GatherListTest, FinishIsIdempotent)
+{
+    const auto expected_size = encode_expected();
+    auto m = sbepp::make_view<test_schema::messages::msg28>(
+        buf.data(), buf.size());
+    encode_fixed(m);
+
+    io.add_external(m.varData(), var_data.data(), var_data.size());
+    io.add_external(m.varStr(), var_str.data(), var_str.size());
+    io.finish(m);
+    const auto segments = gather();
+    io.finish(m);
+
+    ASSERT_EQ(io.size(), 4u);
+    ASSERT_EQ(io.size_bytes(), expected_size);
+    ASSERT_EQ(gather(), segments);
+    ASSERT_EQ(
+        gather(),
+        std::vector<std::uint8_t>(
+            expected_buf.begin(), expected_buf.begin() + expected_size));
+}
+
+TEST_F(GatherListTest, SkipsEmptyPayloads)
+{
+    var_data.clear();
+    const auto expected_size = encode_expected();
+    auto m = sbepp::make_view<test_schema::messages::msg28>(
+        buf.data(), buf.size());
+    encode_fixed(m);
+
+    io.add_external(m.varData(), var_data.data(), var_data.size());
+    m.varStr().assign_string(var_str.c_str());
+    io.finish(m);
+
+    ASSERT_EQ(io.size(), 1u);
+    ASSERT_EQ(io.size_bytes(), expected_size);
+    ASSERT_EQ(
+        gather(),
+        std::vector<std::uint8_t>(
+            expected_buf.begin(), expected_buf.begin() + expected_size));
+}
+
+TEST_F(GatherListTest, ClearResetsState)
+{
+    auto m = sbepp::make_view<test_schema::messages::msg28>(
+        buf.data(), buf.size());
+    encode_fixed(m);
+    io.add_external(m.varData(), var_data.data(), var_data.size());
+    io.finish(m);
+
+    io.clear();
+
+    ASSERT_EQ(io.external_count(), 0u);
+    ASSERT_EQ(io.size(), 0u);
+    ASSERT_EQ(io.size_bytes(), 0u);
+    ASSERT_EQ(io.begin(), io.end());
+}
+} // namespace
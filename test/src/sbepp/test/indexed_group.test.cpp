@@ -0,0 +1,201 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Oleksandr Koval
+
+#include <test_schema/messages/msg3.hpp>
+
+#include <sbepp/test/utils.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+namespace
+{
+using byte_type = std::uint8_t;
+using message_t = test_schema::messages::msg3<byte_type>;
+using group_tag = test_schema::schema::messages::msg3::nested_group;
+using group_t = sbepp::group_traits<group_tag>::value_type<byte_type>;
+using indexed_group_t = sbepp::indexed_group<group_t>;
+using iterator_t = indexed_group_t::iterator;
+
+IS_SAME_TYPE(indexed_group_t::group_type, group_t);
+IS_SAME_TYPE(indexed_group_t::value_type, group_t::value_type);
+IS_SAME_TYPE(indexed_group_t::reference, group_t::value_type);
+IS_SAME_TYPE(indexed_group_t::size_type, group_t::size_type);
+IS_SAME_TYPE(indexed_group_t::difference_type, group_t::difference_type);
+IS_SAME_TYPE(
+    sbepp::indexed_group_storage<group_t>::value_type, std::size_t);
+STATIC_ASSERT(
+    std::tuple_size<sbepp::indexed_group_storage<group_t>>::value
+    == group_t::max_size());
+
+STATIC_ASSERT_V(std::is_nothrow_default_constructible<indexed_group_t>);
+STATIC_ASSERT_V(std::is_trivially_copy_constructible<indexed_group_t>);
+STATIC_ASSERT_V(std::is_trivially_destructible<indexed_group_t>);
+
+STATIC_ASSERT_V(std::is_nothrow_default_constructible<iterator_t>);
+STATIC_ASSERT_V(std::is_trivially_copy_constructible<iterator_t>);
+STATIC_ASSERT_V(std::is_trivially_destructible<iterator_t>);
+STATIC_ASSERT_V(std::is_same<
+                iterator_t::iterator_category,
+                std::random_access_iterator_tag>);
+STATIC_ASSERT_V(std::is_same<iterator_t::value_type, group_t::value_type>);
+STATIC_ASSERT_V(
+    std::is_same<iterator_t::difference_type, group_t::difference_type>);
+
+#if __cpp_lib_concepts >= 202002L
+STATIC_ASSERT(std::random_access_iterator<iterator_t>);
+#endif
+
+constexpr std::uint16_t num_in_group = 5;
+
+class IndexedGroupTest : public ::testing::Test
+{
+public:
+    IndexedGroupTest()
+    {
+        sbepp::fill_message_header(msg);
+        auto g = msg.nested_group();
+        sbepp::fill_group_header(g, num_in_group);
+        std::uint32_t i{};
+        // entries have different sizes
+        for(const auto entry : g)
+        {
+            entry.number(i);
+            sbepp::fill_group_header(entry.flat_group(), i);
+            entry.data().resize(i * 3);
+            i++;
+        }
+    }
+
+    std::array<byte_type, 512> buf{};
+    message_t msg{buf.data(), buf.size()};
+    std::array<std::size_t, 8> offsets{};
+};
+
+TEST_F(IndexedGroupTest, BuildsIndexLazily)
+{
+    auto g = sbepp::make_indexed_group(msg.nested_group(), offsets);
+
+    ASSERT_FALSE(g.is_indexed());
+    ASSERT_EQ(g.size(), num_in_group);
+    ASSERT_FALSE(g.is_indexed());
+
+    g[0];
+
+    ASSERT_TRUE(g.is_indexed());
+}
+
+TEST_F(IndexedGroupTest, ProvidesRandomAccessToEntries)
+{
+    auto g = sbepp::make_indexed_group(
+        msg.nested_group(), offsets.data(), offsets.size());
+    std::size_t index{};
+
+    for(const auto entry : msg.nested_group())
+    {
+        ASSERT_EQ(sbepp::addressof(g[index]), sbepp::addressof(entry));
+        ASSERT_EQ(*g[index].number(), index);
+        index++;
+    }
+    ASSERT_EQ(*g.front().number(), 0u);
+    ASSERT_EQ(*g.back().number(), num_in_group - 1u);
+    ASSERT_EQ(g.capacity(), offsets.size());
+}
+
+TEST_F(IndexedGroupTest, IteratorsAreRandomAccess)
+{
+    auto g = sbepp::make_indexed_group(msg.nested_group(), offsets);
+
+    ASSERT_EQ(std::distance(g.begin(), g.end()), num_in_group);
+    ASSERT_EQ(*(g.begin() + 3)->number(), 3u);
+    ASSERT_EQ(*g.begin()[2].number(), 2u);
+    ASSERT_EQ((g.end() - 1)->data().size(), (num_in_group - 1u) * 3);
+    ASSERT_LT(g.begin(), g.end());
+
+    auto it = std::lower_bound(
+        g.begin(),
+        g.end(),
+        3u,
+        [](const indexed_group_t::value_type entry, const std::uint32_t value)
+        {
+            return *entry.number() < value;
+        });
+    ASSERT_EQ(std::distance(g.begin(), it), 3);
+}
+
+TEST_F(IndexedGroupTest, ProvidesAddressHeaderAndSize)
+{
+    auto g = sbepp::make_indexed_group(msg.nested_group(), offsets);
+
+    ASSERT_EQ(sbepp::addressof(g), sbepp::addressof(msg.nested_group()));
+    ASSERT_EQ(
+        sbepp::addressof(sbepp::get_header(g)),
+        sbepp::addressof(sbepp::get_header(msg.nested_group())));
+    ASSERT_EQ(sbepp::size_bytes(g), sbepp::size_bytes(msg.nested_group()));
+
+    sbepp::fill_group_header(msg.nested_group(), 0);
+    g.reindex();
+
+    ASSERT_EQ(sbepp::size_bytes(g), sbepp::size_bytes(msg.nested_group()));
+}
+
+TEST_F(IndexedGroupTest, ReindexUpdatesOffsets)
+{
+    auto g = sbepp::make_indexed_group(msg.nested_group(), offsets);
+    g.reindex();
+    g[0].data().resize(100);
+
+    ASSERT_NE(
+        sbepp::addressof(g[1]),
+        sbepp::addressof(*std::next(msg.nested_group().begin())));
+
+    g.reindex();
+
+    ASSERT_EQ(
+        sbepp::addressof(g[1]),
+        sbepp::addressof(*std::next(msg.nested_group().begin())));
+}
+
+TEST_F(IndexedGroupTest, AcceptsVectorStorage)
+{
+    std::vector<std::size_t> storage(msg.nested_group().size());
+    auto g = sbepp::make_indexed_group(msg.nested_group(), storage);
+
+    ASSERT_EQ(g.capacity(), storage.size());
+    ASSERT_EQ(*g.back().number(), num_in_group - 1u);
+    ASSERT_EQ(
+        storage[0], sbepp::size_bytes(sbepp::get_header(msg.nested_group())));
+}
+
+TEST_F(IndexedGroupTest, ClampsSizeToCapacityIfStorageIsTooSmall)
+{
+    std::array<std::size_t, num_in_group> storage{};
+    storage.back() = 123;
+    auto g = sbepp::make_indexed_group(
+        msg.nested_group(), storage.data(), num_in_group - 1);
+
+    ASSERT_FALSE(g.reindex());
+    ASSERT_TRUE(g.is_indexed());
+    ASSERT_EQ(g.size(), num_in_group - 1);
+    ASSERT_EQ(g.end() - g.begin(), num_in_group - 1);
+    ASSERT_EQ(*g.back().number(), num_in_group - 2);
+    ASSERT_EQ(storage.back(), 123u);
+    ASSERT_EQ(sbepp::size_bytes(g), sbepp::size_bytes(msg.nested_group()));
+
+    g = sbepp::make_indexed_group(msg.nested_group(), storage.data(), 0);
+
+    ASSERT_TRUE(g.empty());
+    ASSERT_EQ(g.begin(), g.end());
+
+    g = sbepp::make_indexed_group(msg.nested_group(), storage);
+
+    ASSERT_TRUE(g.reindex());
+    ASSERT_EQ(g.size(), num_in_group);
+}
+} // namespace
@@ -0,0 +1,173 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Oleksandr Koval
+
+#include <test_schema/messages/Msg1.hpp>
+#include <test_schema/messages/msg28.hpp>
+
+#include <sbepp/test/utils.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <type_traits>
+
+namespace
+{
+using byte_type = std::uint8_t;
+using message_t = test_schema::messages::msg28<byte_type>;
+using message_tag = test_schema::schema::messages::msg28;
+using indexed_view_t = sbepp::indexed_view<message_t>;
+
+IS_SAME_TYPE(indexed_view_t::message_type, message_t);
+IS_SAME_TYPE(indexed_view_t::tag_type, message_tag);
+using dynamic_member_tags = sbepp::type_list<
+    message_tag::group,
+    message_tag::varData,
+    message_tag::varStr>;
+
+IS_SAME_TYPE(indexed_view_t::dynamic_member_tags, dynamic_member_tags);
+IS_SAME_TYPE(
+    indexed_view_t::member_type<message_tag::varStr>,
+    decltype(std::declval<message_t>().varStr()));
+STATIC_ASSERT(indexed_view_t::dynamic_member_count() == 3);
+STATIC_ASSERT(
+    sbepp::indexed_view<
+        test_schema::messages::Msg1<byte_type>>::dynamic_member_count()
+    == 0);
+
+STATIC_ASSERT_V(std::is_nothrow_default_constructible<indexed_view_t>);
+STATIC_ASSERT_V(std::is_trivially_copy_constructible<indexed_view_t>);
+STATIC_ASSERT_V(std::is_trivially_destructible<indexed_view_t>);
+
+constexpr std::size_t num_in_group = 3;
+constexpr std::size_t var_data_size = 5;
+constexpr std::size_t var_str_size = 7;
+
+class IndexedViewTest : public ::testing::Test
+{
+public:
+    IndexedViewTest()
+    {
+        sbepp::fill_message_header(msg);
+        sbepp::fill_group_header(msg.group(), num_in_group);
+        msg.varData().resize(var_data_size);
+        msg.varStr().resize(var_str_size);
+    }
+
+    std::array<byte_type, 512> buf{};
+    message_t msg{buf.data(), buf.size()};
+
+    std::size_t offset_of(const byte_type* ptr) const
+    {
+        return static_cast<std::size_t>(ptr - buf.data());
+    }
+};
+
+TEST_F(IndexedViewTest, CachesOffsetsOfGroupsAndData)
+{
+    const auto iv = sbepp::make_indexed_view(msg);
+
+    ASSERT_EQ(
+        iv.offset_of<message_tag::group>(),
+        offset_of(sbepp::addressof(msg.group())));
+    ASSERT_EQ(
+        iv.offset_of<message_tag::varData>(),
+        offset_of(sbepp::addressof(msg.varData())));
+    ASSERT_EQ(
+        iv.offset_of<message_tag::varStr>(),
+        offset_of(sbepp::addressof(msg.varStr())));
+}
+
+TEST_F(IndexedViewTest, GetReturnsSameViewsAsMessage)
+{
+    const auto iv = sbepp::make_indexed_view(msg);
+
+    ASSERT_EQ(
+        sbepp::addressof(iv.get<message_tag::group>()),
+        sbepp::addressof(msg.group()));
+    ASSERT_EQ(iv.get<message_tag::group>().size(), num_in_group);
+    ASSERT_EQ(
+        sbepp::addressof(iv.get<message_tag::varData>()),
+        sbepp::addressof(msg.varData()));
+    ASSERT_EQ(iv.get<message_tag::varData>().size(), var_data_size);
+    ASSERT_EQ(
+        sbepp::addressof(iv.get<message_tag::varStr>()),
+        sbepp::addressof(msg.varStr()));
+    ASSERT_EQ(iv.get<message_tag::varStr>().size(), var_str_size);
+    IS_NOEXCEPT(iv.get<message_tag::varStr>());
+}
+
+TEST_F(IndexedViewTest, GetByTagUsesCachedOffsets)
+{
+    const auto iv = sbepp::make_indexed_view(msg);
+
+    ASSERT_EQ(
+        sbepp::addressof(sbepp::get_by_tag<message_tag::varStr>(iv)),
+        sbepp::addressof(msg.varStr()));
+}
+
+TEST_F(IndexedViewTest, ForwardsFieldAccessToMessage)
+{
+    const auto iv = sbepp::make_indexed_view(msg);
+    sbepp::set_by_tag<message_tag::required>(iv, 42);
+
+    ASSERT_EQ(sbepp::get_by_tag<message_tag::required>(iv), 42u);
+    ASSERT_EQ(*msg.required(), 42u);
+}
+
+TEST_F(IndexedViewTest, ProvidesMessageAddressHeaderAndSize)
+{
+    const auto iv = sbepp::make_indexed_view(msg);
+
+    ASSERT_EQ(sbepp::addressof(iv.message()), sbepp::addressof(msg));
+    ASSERT_EQ(sbepp::addressof(iv), sbepp::addressof(msg));
+    ASSERT_EQ(
+        sbepp::addressof(sbepp::get_header(iv)),
+        sbepp::addressof(sbepp::get_header(msg)));
+    ASSERT_EQ(sbepp::size_bytes(iv), sbepp::size_bytes(msg));
+}
+
+TEST_F(IndexedViewTest, SizeBytesWorksWithoutDynamicMembers)
+{
+    test_schema::messages::Msg1<byte_type> m{buf.data(), buf.size()};
+    sbepp::fill_message_header(m);
+    const auto iv = sbepp::make_indexed_view(m);
+
+    ASSERT_EQ(sbepp::size_bytes(iv), sbepp::size_bytes(m));
+}
+
+TEST_F(IndexedViewTest, ReindexUpdatesOffsets)
+{
+    auto iv = sbepp::make_indexed_view(msg);
+    msg.varData().resize(var_data_size * 2);
+
+    ASSERT_NE(
+        sbepp::addressof(iv.get<message_tag::varStr>()),
+        sbepp::addressof(msg.varStr()));
+
+    iv.reindex();
+
+    ASSERT_EQ(
+        sbepp::addressof(iv.get<message_tag::varStr>()),
+        sbepp::addressof(msg.varStr()));
+    ASSERT_EQ(sbepp::size_bytes(iv), sbepp::size_bytes(msg));
+}
+
+#if SBEPP_HAS_CONSTEXPR_ACCESSORS
+constexpr std::size_t constexpr_test()
+{
+    std::array<byte_type, 512> buf{};
+    message_t msg{buf.data(), buf.size()};
+    sbepp::fill_message_header(msg);
+    sbepp::fill_group_header(msg.group(), 2);
+    msg.varData().resize(3);
+
+    const auto iv = sbepp::make_indexed_view(msg);
+
+    return iv.get<message_tag::varData>().size();
+}
+
+STATIC_ASSERT(constexpr_test() == 3);
+#endif
+} // namespace
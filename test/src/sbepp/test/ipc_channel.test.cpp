@@ -0,0 +1,184 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Oleksandr Koval
+
+#include <test_schema/test_schema.hpp>
+#include <traits_test_schema/traits_test_schema.hpp>
+
+#include <sbepp/ipc.hpp>
+#include <sbepp/test/utils.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <limits>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using msg28_tag = test_schema::schema::messages::msg28;
+
+constexpr std::size_t capacity = 1024;
+
+bool try_publish(
+    sbepp::ipc_writer<test_schema::schema>& writer, const std::uint32_t value)
+{
+    const auto claim = writer.claim(
+        sbepp::message_traits<msg28_tag>::size_bytes(0, 0));
+    if(claim.empty())
+    {
+        return false;
+    }
+    auto m = sbepp::make_view<test_schema::messages::msg28>(claim);
+    sbepp::fill_message_header(m);
+    m.required(value);
+    sbepp::fill_group_header(m.group(), 0);
+    m.varData().clear();
+    m.varStr().clear();
+    writer.commit(sbepp::size_bytes(m));
+    return true;
+}
+
+std::uint32_t decode(const std::uint8_t* data, const std::size_t size)
+{
+    const auto m =
+        sbepp::make_const_view<test_schema::messages::msg28>(data, size);
+    EXPECT_EQ(sbepp::size_bytes(m), size);
+    return *m.required();
+}
+
+class IpcChannelTest : public ::testing::Test
+{
+public:
+    alignas(64) std::uint8_t region[sbepp::ipc_region_size(capacity)]{};
+    sbepp::ipc_writer<test_schema::schema> writer;
+    sbepp::ipc_reader<test_schema::schema> reader;
+
+    sbepp::detail::ipc_channel_header& header()
+    {
+        return *reinterpret_cast<sbepp::detail::ipc_channel_header*>(region);
+    }
+};
+
+TEST_F(IpcChannelTest, ReaderCanAttachOnlyToCreatedChannel)
+{
+    ASSERT_EQ(
+        reader.attach(region, sizeof(region)),
+        sbepp::ipc_attach_result::not_initialized);
+
+    writer.create(region, capacity);
+
+    ASSERT_EQ(
+        reader.attach(region, sizeof(region) - 1),
+        sbepp::ipc_attach_result::incompatible_layout);
+    ASSERT_EQ(
+        reader.attach(region, sizeof(region)),
+        sbepp::ipc_attach_result::attached);
+}
+
+TEST_F(IpcChannelTest, ReaderOfDifferentSchemaVersionRefusesToAttach)
+{
+    writer.create(region, capacity);
+    sbepp::ipc_reader<traits_test_schema::schema> other_reader;
+
+    ASSERT_EQ(
+        other_reader.attach(region, sizeof(region)),
+        sbepp::ipc_attach_result::wrong_schema_version);
+}
+
+TEST_F(IpcChannelTest, ReaderOfDifferentSchemaIdRefusesToAttach)
+{
+    writer.create(region, capacity);
+    header().schema_id++;
+
+    ASSERT_EQ(
+        reader.attach(region, sizeof(region)),
+        sbepp::ipc_attach_result::wrong_schema_id);
+}
+
+TEST_F(IpcChannelTest, ReaderRefusesToAttachToChannelWithInvalidCapacity)
+{
+    writer.create(region, capacity);
+
+    for(const std::uint64_t invalid_capacity :
+        {std::uint64_t{0}, std::uint64_t{32}, std::uint64_t{capacity + 1},
+         std::uint64_t{capacity * 2},
+         std::numeric_limits<std::uint64_t>::max()})
+    {
+        header().capacity = invalid_capacity;
+        ASSERT_EQ(
+            reader.attach(region, sizeof(region)),
+            sbepp::ipc_attach_result::incompatible_layout);
+    }
+
+    header().capacity = capacity / 2;
+    ASSERT_EQ(
+        reader.attach(region, sizeof(region)),
+        sbepp::ipc_attach_result::attached);
+}
+
+TEST_F(IpcChannelTest, ReaderReadsMessagesInPlace)
+{
+    writer.create(region, capacity);
+    ASSERT_EQ(
+        reader.attach(region, sizeof(region)),
+        sbepp::ipc_attach_result::attached);
+
+    std::vector<std::uint32_t> values;
+    auto handler = [this, &values](const std::uint8_t* data, std::size_t size)
+    {
+        ASSERT_GT(data, region);
+        ASSERT_LT(data, region + sizeof(region));
+        values.push_back(decode(data, size));
+    };
+    for(std::uint32_t i = 0; i != 100; i++)
+    {
+        ASSERT_TRUE(try_publish(writer, i));
+        reader.wait(sbepp::ipc_wait::busy_spin);
+        ASSERT_EQ(reader.poll(handler), 1u);
+    }
+
+    ASSERT_EQ(values.size(), 100u);
+    ASSERT_EQ(values.back(), 99u);
+}
+
+TEST_F(IpcChannelTest, BlockingReaderIsWokenUpByWriter)
+{
+    constexpr std::uint32_t message_count = 1000;
+    writer.create(region, capacity);
+    ASSERT_EQ(
+        reader.attach(region, sizeof(region)),
+        sbepp::ipc_attach_result::attached);
+
+    std::thread producer{[this]
+                         {
+                             for(std::uint32_t i = 0; i != message_count;)
+                             {
+                                 if(try_publish(writer, i))
+                                 {
+                                     i++;
+                                 }
+                                 else
+                                 {
+                                     std::this_thread::yield();
+                                 }
+                             }
+                         }};
+
+    std::uint32_t expected{};
+    bool in_order{true};
+    while(expected != message_count)
+    {
+        reader.wait(sbepp::ipc_wait::block);
+        reader.poll(
+            [&expected, &in_order](const std::uint8_t* data, std::size_t size)
+            {
+                in_order = in_order && (decode(data, size) == expected);
+                expected++;
+            });
+    }
+    producer.join();
+
+    ASSERT_TRUE(in_order);
+}
+} // namespace
@@ -0,0 +1,134 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Oleksandr Koval
+
+#include <test_schema/test_schema.hpp>
+#include <big_endian_schema/big_endian_schema.hpp>
+
+#include <sbepp/test/utils.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+namespace
+{
+using msg2_t = test_schema::messages::msg2<std::uint8_t>;
+using msg2_block_t = decltype(sbepp::load_block(std::declval<msg2_t>()));
+using entry_block_t = decltype(sbepp::load_block(
+    *std::declval<msg2_t>().group().begin()));
+using be_entry_block_t = decltype(sbepp::load_block(
+    std::declval<big_endian_schema::messages::msg2<std::uint8_t>>()
+        .group()[0]));
+
+IS_SAME_TYPE(decltype(msg2_block_t::number), test_schema::types::uint32_req);
+IS_SAME_TYPE(
+    decltype(msg2_block_t::enumeration), test_schema::types::numbers_enum);
+IS_SAME_TYPE(decltype(msg2_block_t::set), test_schema::types::options_set);
+IS_SAME_TYPE(decltype(entry_block_t::number), test_schema::types::uint32_req);
+IS_SAME_TYPE(
+    decltype(be_entry_block_t::optional), big_endian_schema::types::int32_opt);
+STATIC_ASSERT_V(std::is_trivially_copyable<msg2_block_t>);
+STATIC_ASSERT_V(std::is_trivially_copyable<be_entry_block_t>);
+
+template<typename T, typename = void>
+struct has_array_member : std::false_type
+{
+};
+
+template<typename T>
+struct has_array_member<T, decltype(void(std::declval<T>().array))>
+    : std::true_type
+{
+};
+
+template<typename T, typename = void>
+struct has_composite_member : std::false_type
+{
+};
+
+template<typename T>
+struct has_composite_member<T, decltype(void(std::declval<T>().composite))>
+    : std::true_type
+{
+};
+
+// arrays and composites are represented by views
+STATIC_ASSERT(!has_array_member<msg2_block_t>::value);
+STATIC_ASSERT(!has_composite_member<msg2_block_t>::value);
+// constants are not stored in the block
+using msg1_t = test_schema::messages::Msg1<std::uint8_t>;
+STATIC_ASSERT_V(
+    std::is_empty<decltype(sbepp::load_block(std::declval<msg1_t>()))>);
+
+TEST(LoadBlockTest, LoadsAllMessageFields)
+{
+    std::array<std::uint8_t, 1024> buf{};
+    auto m = sbepp::make_view<test_schema::messages::msg2>(
+        buf.data(), buf.size());
+    sbepp::fill_message_header(m);
+    m.number(1);
+    m.enumeration(test_schema::types::numbers_enum::Two);
+    m.set(test_schema::types::options_set{}.A(true));
+
+    const auto block = sbepp::load_block(m);
+
+    ASSERT_EQ(block.number, m.number());
+    ASSERT_EQ(block.enumeration, m.enumeration());
+    ASSERT_EQ(block.set, m.set());
+}
+
+TEST(LoadBlockTest, LoadsAllEntryFields)
+{
+    std::array<std::uint8_t, 1024> buf{};
+    auto m = sbepp::make_view<test_schema::messages::msg2>(
+        buf.data(), buf.size());
+    sbepp::fill_message_header(m);
+    sbepp::fill_group_header(m.group(), 1);
+    auto e = *m.group().begin();
+    e.number(2);
+    e.enumeration(test_schema::types::numbers_enum::One);
+
+    const auto block = sbepp::load_block(e);
+
+    ASSERT_EQ(block.number, e.number());
+    ASSERT_EQ(block.enumeration, e.enumeration());
+    ASSERT_EQ(block.set, e.set());
+}
+
+TEST(LoadBlockTest, ConvertsFromSchemaByteOrder)
+{
+    std::array<std::uint8_t, 64> buf{};
+    auto m = sbepp::make_view<big_endian_schema::messages::msg2>(
+        buf.data(), buf.size());
+    sbepp::fill_message_header(m);
+    sbepp::fill_group_header(m.group(), 1);
+    auto e = m.group()[0];
+    e.price(-123);
+    e.quantity(0x01020304);
+    e.number(big_endian_schema::types::numbers_enum::Two);
+    e.optional(sbepp::nullopt);
+    e.ratio(1.5);
+
+    const auto block = sbepp::load_block(e);
+
+    ASSERT_EQ(block.price, -123);
+    ASSERT_EQ(block.quantity, 0x01020304u);
+    ASSERT_EQ(block.number, big_endian_schema::types::numbers_enum::Two);
+    ASSERT_FALSE(block.optional.has_value());
+    ASSERT_EQ(block.ratio, 1.5);
+}
+
+TEST(LoadBlockDeathTest, TerminatesIfBlockDoesNotFitBuffer)
+{
+    std::array<std::uint8_t, 1024> buf{};
+    const auto header_size = sbepp::composite_traits<
+        test_schema::schema::types::messageHeader>::size_bytes();
+    const auto m = sbepp::make_view<test_schema::messages::msg2>(
+        buf.data(), header_size + 1);
+
+    ASSERT_DEATH({ sbepp::load_block(m); }, ".*");
+}
+} // namespace
@@ -0,0 +1,160 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Oleksandr Koval
+
+#include <test_schema/test_schema.hpp>
+
+#include <sbepp/test/utils.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace
+{
+using byte_type = std::uint8_t;
+using msg28_tag = test_schema::schema::messages::msg28;
+using buffer_t = sbepp::message_buffer<test_schema::messages::msg28>;
+
+IS_SAME_TYPE(buffer_t::byte_type, byte_type);
+IS_SAME_TYPE(buffer_t::view_type, test_schema::messages::msg28<byte_type>);
+IS_SAME_TYPE(
+    buffer_t::const_view_type, test_schema::messages::msg28<const byte_type>);
+IS_SAME_TYPE(buffer_t::allocator_type, std::allocator<byte_type>);
+STATIC_ASSERT(
+    buffer_t::inline_capacity()
+    == sbepp::composite_traits<
+           test_schema::schema::types::messageHeader>::size_bytes()
+           + sbepp::message_traits<msg28_tag>::block_length());
+STATIC_ASSERT_V(std::is_nothrow_move_constructible<buffer_t>);
+
+// counts allocated bytes, all instances share the same counter
+template<typename T>
+struct counting_allocator
+{
+    using value_type = T;
+
+    counting_allocator() = default;
+
+    explicit counting_allocator(std::size_t* allocated) noexcept
+        : allocated{allocated}
+    {
+    }
+
+    T* allocate(const std::size_t n)
+    {
+        *allocated += n;
+        return std::allocator<T>{}.allocate(n);
+    }
+
+    void deallocate(T* p, const std::size_t n) noexcept
+    {
+        *allocated -= n;
+        std::allocator<T>{}.deallocate(p, n);
+    }
+
+    friend bool operator==(
+        const counting_allocator& lhs, const counting_allocator& rhs) noexcept
+    {
+        return lhs.allocated == rhs.allocated;
+    }
+
+    friend bool operator!=(
+        const counting_allocator& lhs, const counting_allocator& rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+    std::size_t* allocated{};
+};
+
+using counting_buffer_t = sbepp::message_buffer<
+    test_schema::messages::msg28,
+    counting_allocator<byte_type>>;
+
+class MessageBufferTest : public ::testing::Test
+{
+public:
+    std::size_t allocated{};
+    counting_buffer_t buf{counting_allocator<byte_type>{&allocated}};
+};
+
+TEST_F(MessageBufferTest, FixedPartFitsIntoInlineBuffer)
+{
+    auto m = buf.view();
+    sbepp::fill_message_header(m);
+    m.required(1);
+
+    ASSERT_TRUE(buf.is_inline());
+    ASSERT_EQ(buf.capacity(), buf.inline_capacity());
+    ASSERT_EQ(sbepp::addressof(m), buf.data());
+    ASSERT_EQ(allocated, 0u);
+}
+
+TEST_F(MessageBufferTest, ReserveMovesContentToAllocatedBuffer)
+{
+    auto m = buf.view();
+    sbepp::fill_message_header(m);
+    m.required(1);
+    const auto size = sbepp::message_traits<msg28_tag>::size_bytes(2, 3);
+
+    buf.reserve(size);
+    m = buf.view();
+    sbepp::fill_group_header(m.group(), 2);
+    m.group()[1].number(2);
+    m.varData().resize(0);
+    m.varStr().assign_string("abc");
+
+    ASSERT_FALSE(buf.is_inline());
+    ASSERT_GE(buf.capacity(), size);
+    ASSERT_EQ(allocated, buf.capacity());
+    ASSERT_EQ(*m.required(), 1u);
+    ASSERT_EQ(sbepp::size_bytes(m), size);
+
+    // doesn't shrink
+    const auto capacity = buf.capacity();
+    buf.reserve(1);
+
+    ASSERT_EQ(buf.capacity(), capacity);
+}
+
+TEST_F(MessageBufferTest, CopyAndMovePreserveContent)
+{
+    buf.reserve(buf.inline_capacity() + 1);
+    sbepp::fill_message_header(buf.view());
+    buf.view().required(1);
+    const auto data = buf.data();
+
+    auto copy = buf;
+
+    ASSERT_NE(copy.data(), data);
+    ASSERT_EQ(copy.capacity(), buf.capacity());
+    ASSERT_EQ(*copy.view().required(), 1u);
+    ASSERT_EQ(allocated, buf.capacity() * 2);
+
+    auto moved = std::move(buf);
+
+    ASSERT_EQ(moved.data(), data);
+    ASSERT_TRUE(buf.is_inline());
+    ASSERT_EQ(*moved.view().required(), 1u);
+
+    copy = std::move(moved);
+
+    ASSERT_EQ(copy.data(), data);
+    ASSERT_EQ(allocated, copy.capacity());
+}
+
+TEST(MessageBufferInlineTest, MoveCopiesInlineBuffer)
+{
+    buffer_t buf;
+    sbepp::fill_message_header(buf.view());
+    buf.view().required(1);
+
+    const auto moved = std::move(buf);
+
+    ASSERT_TRUE(moved.is_inline());
+    ASSERT_EQ(*moved.view().required(), 1u);
+}
+} // namespace
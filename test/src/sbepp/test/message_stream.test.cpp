@@ -0,0 +1,299 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Oleksandr Koval
+
+#include <test_schema/test_schema.hpp>
+
+#include <sbepp/test/utils.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+namespace
+{
+using byte_type = std::uint8_t;
+using schema_tag = test_schema::schema;
+using stream_t = sbepp::message_stream<schema_tag, byte_type>;
+using iterator_t = stream_t::iterator;
+using const_stream_t = sbepp::message_stream<schema_tag, const byte_type>;
+using sofh_stream_t =
+    sbepp::message_stream<schema_tag, byte_type, sbepp::sofh_framing>;
+
+IS_SAME_TYPE(
+    decltype(sbepp::make_message_stream<schema_tag>(
+        std::declval<const byte_type*>(), 0)),
+    const_stream_t);
+IS_SAME_TYPE(
+    decltype(sbepp::make_message_stream<schema_tag, sbepp::sofh_framing>(
+        std::declval<byte_type*>(), 0)),
+    sofh_stream_t);
+IS_SAME_TYPE(stream_t::byte_type, byte_type);
+IS_SAME_TYPE(stream_t::value_type, sbepp::stream_message<byte_type>);
+
+STATIC_ASSERT_V(std::is_nothrow_default_constructible<stream_t>);
+STATIC_ASSERT_V(std::is_trivially_copy_constructible<stream_t>);
+STATIC_ASSERT_V(std::is_nothrow_default_constructible<iterator_t>);
+STATIC_ASSERT_V(std::is_trivially_copy_constructible<iterator_t>);
+STATIC_ASSERT_V(std::is_same<
+                iterator_t::iterator_category,
+                std::forward_iterator_tag>);
+
+#if __cpp_lib_concepts >= 202002L
+STATIC_ASSERT(std::forward_iterator<iterator_t>);
+#endif
+
+constexpr std::size_t sofh_size = 6;
+
+struct recorded_message
+{
+    sbepp::message_id_t id;
+    const byte_type* data;
+};
+
+struct recorder
+{
+    template<typename Message>
+    void operator()(const Message m)
+    {
+        messages.push_back(
+            {sbepp::message_traits<sbepp::traits_tag_t<Message>>::id(),
+             sbepp::addressof(m)});
+    }
+
+    std::vector<recorded_message> messages;
+};
+
+class MessageStreamTest : public ::testing::Test
+{
+public:
+    // writes messages: msg4, msg27 (with group and data), msg4
+    std::size_t write_messages(const bool with_sofh)
+    {
+        std::size_t offset{};
+        offsets.clear();
+
+        offset += write_message<test_schema::messages::msg4>(
+            offset,
+            with_sofh,
+            [](test_schema::messages::msg4<byte_type> m)
+            {
+                m.number1(1);
+            });
+        offset += write_message<test_schema::messages::msg27>(
+            offset,
+            with_sofh,
+            [](test_schema::messages::msg27<byte_type> m)
+            {
+                sbepp::fill_group_header(m.group(), 2);
+                m.data().resize(3);
+            });
+        offset += write_message<test_schema::messages::msg4>(
+            offset,
+            with_sofh,
+            [](test_schema::messages::msg4<byte_type> m)
+            {
+                m.number1(2);
+            });
+
+        return offset;
+    }
+
+    template<template<typename> class Message, typename F>
+    std::size_t write_message(std::size_t offset, const bool with_sofh, F fill)
+    {
+        auto begin = offset;
+        if(with_sofh)
+        {
+            offset += sofh_size;
+        }
+        auto m = sbepp::make_view<Message>(
+            buf.data() + offset, buf.size() - offset);
+        sbepp::fill_message_header(m);
+        fill(m);
+        offsets.push_back(offset);
+        const auto message_size = sbepp::size_bytes(m);
+        const auto frame_size = offset + message_size - begin;
+
+        if(with_sofh)
+        {
+            write_sofh(begin, frame_size, 0xEB50);
+        }
+
+        return frame_size;
+    }
+
+    void write_sofh(
+        const std::size_t offset,
+        const std::size_t frame_size,
+        const std::uint16_t encoding_type)
+    {
+        buf[offset] = static_cast<byte_type>(frame_size >> 24);
+        buf[offset + 1] = static_cast<byte_type>(frame_size >> 16);
+        buf[offset + 2] = static_cast<byte_type>(frame_size >> 8);
+        buf[offset + 3] = static_cast<byte_type>(frame_size);
+        buf[offset + 4] = static_cast<byte_type>(encoding_type >> 8);
+        buf[offset + 5] = static_cast<byte_type>(encoding_type);
+    }
+
+    std::array<byte_type, 512> buf{};
+    std::vector<std::size_t> offsets;
+};
+
+TEST_F(MessageStreamTest, IteratesOverBackToBackMessages)
+{
+    const auto size = write_messages(false);
+    auto stream = sbepp::make_message_stream<schema_tag>(buf.data(), size);
+    std::vector<sbepp::stream_message<byte_type>> messages{
+        stream.begin(), stream.end()};
+
+    ASSERT_EQ(messages.size(), 3u);
+    ASSERT_EQ(messages[0].template_id(), 4u);
+    ASSERT_EQ(messages[1].template_id(), 27u);
+    ASSERT_EQ(messages[2].template_id(), 4u);
+    for(std::size_t i = 0; i != messages.size(); i++)
+    {
+        ASSERT_EQ(messages[i].data(), buf.data() + offsets[i]);
+    }
+    ASSERT_EQ(messages[1].size(), offsets[2] - offsets[1]);
+    ASSERT_EQ(messages[2].data() + messages[2].size(), buf.data() + size);
+}
+
+TEST_F(MessageStreamTest, ForEachDispatchesMessages)
+{
+    const auto size = write_messages(false);
+    auto stream = sbepp::make_message_stream<schema_tag>(
+        static_cast<const byte_type*>(buf.data()), size);
+    recorder r;
+
+    ASSERT_EQ(stream.for_each(r), size);
+    ASSERT_EQ(r.messages.size(), 3u);
+    ASSERT_EQ(r.messages[0].id, 4u);
+    ASSERT_EQ(r.messages[1].id, 27u);
+    ASSERT_EQ(r.messages[1].data, buf.data() + offsets[1]);
+    ASSERT_EQ(r.messages[2].id, 4u);
+}
+
+TEST_F(MessageStreamTest, StopsAtIncompleteMessage)
+{
+    const auto size = write_messages(false);
+    auto stream =
+        sbepp::make_message_stream<schema_tag>(buf.data(), size - 1);
+    recorder r;
+
+    ASSERT_EQ(std::distance(stream.begin(), stream.end()), 2);
+    ASSERT_EQ(stream.for_each(r), offsets[2]);
+    ASSERT_EQ(r.messages.size(), 2u);
+
+    // not enough even for the header
+    stream =
+        sbepp::make_message_stream<schema_tag>(buf.data(), offsets[1] + 1);
+
+    ASSERT_EQ(stream.for_each(recorder{}), offsets[1]);
+
+    const auto m = sbepp::make_view<test_schema::messages::msg27>(
+        buf.data() + offsets[1], buf.size() - offsets[1]);
+    const std::size_t cuts[] = {
+        // inside the group
+        static_cast<std::size_t>(
+            sbepp::addressof(m.group()) + 1 - buf.data()),
+        // inside the data
+        static_cast<std::size_t>(sbepp::addressof(m.data()) + 1 - buf.data()),
+        offsets[2] - 1};
+
+    for(const auto cut : cuts)
+    {
+        stream = sbepp::make_message_stream<schema_tag>(buf.data(), cut);
+        recorder r2;
+
+        ASSERT_EQ(stream.for_each(r2), offsets[1]);
+        ASSERT_EQ(r2.messages.size(), 1u);
+    }
+}
+
+TEST_F(MessageStreamTest, StopsAtUnknownMessage)
+{
+    const auto size = write_messages(false);
+    sbepp::get_header(sbepp::make_view<test_schema::messages::msg4>(
+                          buf.data() + offsets[1], buf.size()))
+        .templateId(1000);
+    auto stream = sbepp::make_message_stream<schema_tag>(buf.data(), size);
+
+    ASSERT_EQ(std::distance(stream.begin(), stream.end()), 1);
+    ASSERT_EQ(stream.for_each(recorder{}), offsets[1]);
+}
+
+TEST_F(MessageStreamTest, EmptyStreamHasNoMessages)
+{
+    stream_t stream;
+
+    ASSERT_EQ(stream.begin(), stream.end());
+    ASSERT_EQ(stream.for_each(recorder{}), 0u);
+}
+
+TEST_F(MessageStreamTest, SupportsSofhFraming)
+{
+    const auto size = write_messages(true);
+    auto stream = sbepp::make_message_stream<schema_tag, sbepp::sofh_framing>(
+        buf.data(), size);
+    recorder r;
+
+    ASSERT_EQ(stream.for_each(r), size);
+    ASSERT_EQ(r.messages.size(), 3u);
+    std::size_t i{};
+    for(const auto m : stream)
+    {
+        ASSERT_EQ(m.data(), buf.data() + offsets[i]);
+        ASSERT_EQ(r.messages[i].data, buf.data() + offsets[i]);
+        i++;
+    }
+    ASSERT_EQ(i, 3u);
+}
+
+TEST_F(MessageStreamTest, SofhFrameCanContainPadding)
+{
+    std::size_t offset = write_message<test_schema::messages::msg4>(
+        0,
+        true,
+        [](test_schema::messages::msg4<byte_type>) {});
+    // frame is larger than the message
+    write_sofh(0, offset + 10, 0xEB50);
+    offset += 10;
+    offset += write_message<test_schema::messages::msg4>(
+        offset,
+        true,
+        [](test_schema::messages::msg4<byte_type>) {});
+    auto stream = sbepp::make_message_stream<schema_tag, sbepp::sofh_framing>(
+        buf.data(), offset);
+    recorder r;
+
+    ASSERT_EQ(stream.for_each(r), offset);
+    ASSERT_EQ(r.messages.size(), 2u);
+    ASSERT_EQ(r.messages[1].data, buf.data() + offsets[1]);
+}
+
+TEST_F(MessageStreamTest, StopsAtInvalidSofh)
+{
+    const auto size = write_messages(true);
+    // wrong encoding type
+    write_sofh(offsets[1] - sofh_size, offsets[2] - offsets[1], 0x5BE0);
+    auto stream = sbepp::make_message_stream<schema_tag, sbepp::sofh_framing>(
+        buf.data(), size);
+
+    ASSERT_EQ(stream.for_each(recorder{}), offsets[1] - sofh_size);
+
+    // frame is shorter than the message
+    write_sofh(offsets[1] - sofh_size, sofh_size + 1, 0xEB50);
+
+    ASSERT_EQ(stream.for_each(recorder{}), offsets[1] - sofh_size);
+
+    // frame goes beyond the buffer
+    stream = sbepp::make_message_stream<schema_tag, sbepp::sofh_framing>(
+        buf.data(), offsets[0] + 1);
+
+    ASSERT_EQ(stream.for_each(recorder{}), 0u);
+}
+} // namespace
@@ -0,0 +1,105 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Oleksandr Koval
+
+#include <test_schema/test_schema.hpp>
+
+#include <sbepp/test/utils.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <type_traits>
+
+namespace
+{
+using byte_type = std::uint8_t;
+using msg4_tag = test_schema::schema::messages::msg4;
+using template_t =
+    sbepp::message_template<test_schema::messages::msg4, 32, byte_type>;
+
+IS_SAME_TYPE(template_t::byte_type, byte_type);
+IS_SAME_TYPE(
+    decltype(std::declval<template_t>().view()),
+    test_schema::messages::msg4<const byte_type>);
+STATIC_ASSERT_V(std::is_trivially_copy_constructible<template_t>);
+STATIC_ASSERT_V(std::is_trivially_copy_assignable<template_t>);
+
+void fill_msg28(test_schema::messages::msg28<byte_type> m)
+{
+    m.required(1);
+    m.optional1(2);
+    sbepp::fill_group_header(m.group(), 2);
+    m.group()[0].number(3);
+    m.group()[1].number(4);
+    m.varData().resize(0);
+    m.varStr().assign_string("abc");
+}
+
+TEST(MessageTemplateTest, CopiesEncodedMessage)
+{
+    const auto t =
+        sbepp::make_message_template<test_schema::messages::msg28, 512>(
+            fill_msg28);
+    std::array<byte_type, 512> expected{};
+    const auto expected_msg = sbepp::make_view<test_schema::messages::msg28>(
+        expected.data(), expected.size());
+    sbepp::fill_message_header(expected_msg);
+    fill_msg28(expected_msg);
+    std::array<byte_type, 512> buf{};
+
+    const auto m = t.encode(buf.data(), buf.size());
+
+    ASSERT_EQ(t.size(), sbepp::size_bytes(expected_msg));
+    ASSERT_EQ(sbepp::size_bytes(m), t.size());
+    ASSERT_EQ(sbepp::addressof(m), buf.data());
+    ASSERT_TRUE(std::equal(buf.begin(), buf.end(), expected.begin()));
+    ASSERT_EQ(*t.view().group()[1].number(), 4u);
+    ASSERT_EQ(sbepp::addressof(t.view()), t.data());
+}
+
+TEST(MessageTemplateTest, OnlyChangedFieldsNeedToBeSet)
+{
+    const template_t t{[](test_schema::messages::msg4<byte_type> m)
+                       {
+                           m.number1(1);
+                           m.number2(2);
+                       }};
+    std::array<byte_type, 32> buf{};
+
+    const auto m = t.encode(buf.data(), buf.size());
+    m.number2(3);
+
+    ASSERT_EQ(*m.number1(), 1u);
+    ASSERT_EQ(*m.number2(), 3u);
+    // template is not affected
+    ASSERT_EQ(*t.view().number2(), 2u);
+    ASSERT_EQ(
+        *sbepp::get_header(m).templateId(),
+        sbepp::message_traits<msg4_tag>::id());
+}
+
+#if SBEPP_HAS_CONSTEXPR_ACCESSORS
+constexpr auto constexpr_template = template_t{
+    [](test_schema::messages::msg4<byte_type> m)
+    {
+        m.number1(1);
+    }};
+
+STATIC_ASSERT(
+    constexpr_template.size()
+    == sbepp::message_traits<msg4_tag>::size_bytes());
+STATIC_ASSERT(*constexpr_template.view().number1() == 1);
+
+constexpr auto constexpr_encode()
+{
+    std::array<byte_type, 32> buf{};
+    constexpr_template.encode(buf.data(), buf.size()).number2(2);
+
+    return buf;
+}
+
+constexpr auto buf = constexpr_encode();
+#endif
+} // namespace
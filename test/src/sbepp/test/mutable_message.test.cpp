@@ -0,0 +1,170 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Oleksandr Koval
+
+#include <test_schema/test_schema.hpp>
+
+#include <sbepp/test/utils.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <type_traits>
+
+namespace
+{
+using byte_type = std::uint8_t;
+using msg28_tags = test_schema::schema::messages::msg28;
+using msg29_tags = test_schema::schema::messages::msg29;
+using message_t = test_schema::messages::msg28<byte_type>;
+using mutable_message_t = sbepp::mutable_message<message_t>;
+
+IS_SAME_TYPE(
+    decltype(sbepp::make_mutable_message(std::declval<message_t>())),
+    mutable_message_t);
+IS_SAME_TYPE(mutable_message_t::view_type, message_t);
+IS_SAME_TYPE(mutable_message_t::byte_type, byte_type);
+STATIC_ASSERT_V(std::is_nothrow_default_constructible<mutable_message_t>);
+STATIC_ASSERT_V(std::is_trivially_copy_constructible<mutable_message_t>);
+
+template<typename Data>
+std::string to_string(const Data d)
+{
+    return {d.begin(), d.end()};
+}
+
+class MutableMessageTest : public ::testing::Test
+{
+public:
+    // msg28 with 2 group entries, "abc" varData and "hello" varStr
+    MutableMessageTest()
+    {
+        auto enc = sbepp::make_encoder(
+            sbepp::make_view<test_schema::messages::msg28>(
+                buf.data(), buf.size()));
+        auto g = enc.group<msg28_tags::group>();
+        g.emplace_back().set<msg28_tags::group::number>(1);
+        g.emplace_back().set<msg28_tags::group::number>(2);
+        enc.assign_string<msg28_tags::varData>("abc")
+            .assign_string<msg28_tags::varStr>("hello");
+        m = enc.view();
+    }
+
+    std::array<byte_type, 512> buf{};
+    message_t m;
+};
+
+TEST_F(MutableMessageTest, ResizingDataMovesFollowingMembers)
+{
+    auto mm = sbepp::make_mutable_message(m);
+    const auto old_size = mm.size();
+
+    mm.resize(m.varData(), 5);
+
+    ASSERT_EQ(mm.size(), old_size + 2);
+    ASSERT_EQ(mm.size(), sbepp::size_bytes(m));
+    ASSERT_EQ(m.varData().size(), 5u);
+    ASSERT_EQ(m.varData()[3], 0);
+    ASSERT_EQ(m.varData()[4], 0);
+    ASSERT_EQ(to_string(m.varStr()), "hello");
+
+    mm.resize(m.varData(), 1);
+
+    ASSERT_EQ(mm.size(), old_size - 2);
+    ASSERT_EQ(mm.size(), sbepp::size_bytes(m));
+    ASSERT_EQ(m.varData()[0], 'a');
+    ASSERT_EQ(to_string(m.varStr()), "hello");
+}
+
+TEST_F(MutableMessageTest, AssignsDataInTheMiddleOfMessage)
+{
+    auto mm = sbepp::make_mutable_message(m);
+
+    mm.assign_string(m.varData(), "longer text");
+
+    ASSERT_EQ(to_string(m.varData()), "longer text");
+    ASSERT_EQ(to_string(m.varStr()), "hello");
+    ASSERT_EQ(mm.size(), sbepp::size_bytes(m));
+
+    const std::array<byte_type, 2> data{'x', 'y'};
+    mm.assign_range(m.varData(), data);
+
+    ASSERT_EQ(to_string(m.varData()), "xy");
+    ASSERT_EQ(to_string(m.varStr()), "hello");
+    ASSERT_EQ(mm.size(), sbepp::size_bytes(m));
+
+    // the last member works the same way
+    mm.assign_string(m.varStr(), "");
+
+    ASSERT_TRUE(m.varStr().empty());
+    ASSERT_EQ(mm.size(), sbepp::size_bytes(m));
+}
+
+TEST_F(MutableMessageTest, ResizingGroupMovesFollowingMembers)
+{
+    auto mm = sbepp::make_mutable_message(m);
+
+    mm.resize(m.group(), 4);
+
+    ASSERT_EQ(m.group().size(), 4u);
+    ASSERT_EQ(*m.group()[1].number(), 2u);
+    ASSERT_EQ(*m.group()[3].number(), 0u);
+    ASSERT_EQ(to_string(m.varData()), "abc");
+    ASSERT_EQ(to_string(m.varStr()), "hello");
+    ASSERT_EQ(mm.size(), sbepp::size_bytes(m));
+
+    const auto it =
+        mm.erase(m.group(), m.group().begin(), m.group().begin() + 1);
+
+    ASSERT_EQ(it, m.group().begin());
+    ASSERT_EQ(*m.group()[0].number(), 2u);
+    ASSERT_EQ(mm.size(), sbepp::size_bytes(m));
+
+    mm.resize(m.group(), 0);
+
+    ASSERT_TRUE(m.group().empty());
+    ASSERT_EQ(to_string(m.varStr()), "hello");
+    ASSERT_EQ(mm.size(), sbepp::size_bytes(m));
+}
+
+TEST_F(MutableMessageTest, ModifiesMembersOfNestedGroups)
+{
+    // msg29 doesn't fit into the default buffer after insertion
+    std::array<byte_type, 1024> storage{};
+    auto enc =
+        sbepp::make_encoder(sbepp::make_view<test_schema::messages::msg29>(
+            storage.data(), storage.size()));
+    enc.group<msg29_tags::first_group>();
+    auto g = enc.group<msg29_tags::group>();
+    for(std::uint32_t i = 0; i != 2; i++)
+    {
+        auto e = g.emplace_back();
+        e.set<msg29_tags::group::number>(i);
+        e.group<msg29_tags::group::first_group>();
+        e.group<msg29_tags::group::group>();
+        e.assign_string<msg29_tags::group::data>("x");
+    }
+    enc.assign_string<msg29_tags::data>("z");
+    auto m = enc.view();
+    auto mm = sbepp::make_mutable_message(m);
+
+    mm.assign_string(m.group().begin()->data(), "first");
+    mm.resize(m.group().begin()->first_group(), 2);
+    mm.insert(m.group(), m.group().begin(), 1);
+
+    ASSERT_EQ(mm.size(), sbepp::size_bytes(m));
+    ASSERT_EQ(m.group().size(), 3u);
+    auto it = m.group().begin();
+    ASSERT_TRUE(it->data().empty());
+    ++it;
+    ASSERT_EQ(*it->number(), 0u);
+    ASSERT_EQ(it->first_group().size(), 2u);
+    ASSERT_EQ(to_string(it->data()), "first");
+    ++it;
+    ASSERT_EQ(*it->number(), 1u);
+    ASSERT_EQ(to_string(it->data()), "x");
+    ASSERT_EQ(to_string(m.data()), "z");
+}
+} // namespace
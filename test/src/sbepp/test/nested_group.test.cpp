@@ -290,6 +290,70 @@ TEST_F(NestedGroupTest, BeginEndRepresentsEntriesWithinCurrentSize)
     STATIC_ASSERT(noexcept(g.end()));
 }
 
+TEST_F(NestedGroupTest, InsertAddsEmptyEntriesAndShiftsTail)
+{
+    sbepp::fill_group_header(g, 0);
+    auto tail = sbepp::addressof(g) + sbepp::size_bytes(g);
+    *tail = 0xAA;
+
+    auto it = g.insert(g.end(), 2, tail + 1);
+
+    ASSERT_EQ(it, g.begin());
+    ASSERT_EQ(g.size(), 2);
+    for(const auto entry : g)
+    {
+        ASSERT_EQ(entry.number(), 0);
+        ASSERT_EQ(
+            sbepp::get_header(entry.flat_group()).blockLength(),
+            sbepp::group_traits<group_tag::flat_group>::block_length());
+        ASSERT_TRUE(entry.flat_group().empty());
+        ASSERT_TRUE(entry.data().empty());
+    }
+    tail = sbepp::addressof(g) + sbepp::size_bytes(g);
+    ASSERT_EQ(*tail, 0xAA);
+
+    // grow a group inside the first entry, the second entry is moved
+    auto flat = g.begin()->flat_group();
+    flat.insert(flat.end(), 1, tail + 1);
+    flat[0].number(5);
+    g.begin()->number(1);
+    std::next(g.begin())->number(2);
+
+    ASSERT_EQ(g.begin()->flat_group()[0].number(), 5);
+    ASSERT_EQ(std::next(g.begin())->number(), 2);
+    ASSERT_TRUE(std::next(g.begin())->flat_group().empty());
+    ASSERT_EQ(*(sbepp::addressof(g) + sbepp::size_bytes(g)), 0xAA);
+    STATIC_ASSERT(noexcept(g.insert(g.begin(), 1, tail)));
+}
+
+TEST_F(NestedGroupTest, EraseRemovesEntriesAndShiftsTail)
+{
+    sbepp::fill_group_header(g, 0);
+    auto tail = sbepp::addressof(g) + sbepp::size_bytes(g);
+    *tail = 0xAA;
+    g.insert(g.end(), 3, tail + 1);
+    std::uint32_t number{};
+    for(const auto entry : g)
+    {
+        entry.number(number++);
+    }
+    tail = sbepp::addressof(g) + sbepp::size_bytes(g);
+
+    auto it = g.erase(g.begin(), std::next(g.begin(), 2), tail + 1);
+
+    ASSERT_EQ(it, g.begin());
+    ASSERT_EQ(g.size(), 1);
+    ASSERT_EQ(g.begin()->number(), 2);
+    ASSERT_EQ(*(sbepp::addressof(g) + sbepp::size_bytes(g)), 0xAA);
+
+    tail = sbepp::addressof(g) + sbepp::size_bytes(g);
+    it = g.erase(g.begin(), g.end(), tail + 1);
+
+    ASSERT_EQ(it, g.end());
+    ASSERT_TRUE(g.empty());
+    ASSERT_EQ(*(sbepp::addressof(g) + sbepp::size_bytes(g)), 0xAA);
+}
+
 TEST_F(NestedGroupTest, FillGroupHeaderSetsBlockLengthAndNumInGroup)
 {
     static constexpr auto num_in_group = 3;
@@ -338,6 +402,8 @@ constexpr auto constexpr_test()
     g3.end();
     g3.front();
     g3.clear();
+    g3.insert(g3.begin(), 1, buf.data() + sbepp::size_bytes(g3));
+    g3.erase(g3.begin(), g3.end(), buf.data() + sbepp::size_bytes(g3));
 
     sbepp::addressof(g3);
     sbepp::size_bytes(g3);
@@ -0,0 +1,183 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Oleksandr Koval
+
+#include <test_schema/test_schema.hpp>
+
+#include <sbepp/test/utils.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace
+{
+using byte_type = std::uint8_t;
+using schema_tag = test_schema::schema;
+using buffer_t = sbepp::segmented_buffer<const byte_type>;
+using message_t = test_schema::messages::msg27<const byte_type>;
+using result_t = sbepp::access_result<message_t>;
+
+IS_SAME_TYPE(
+    decltype(sbepp::make_segmented_view<test_schema::messages::msg27>(
+        std::declval<buffer_t>(), nullptr, 0)),
+    result_t);
+
+class SegmentedBufferTest : public ::testing::Test
+{
+public:
+    SegmentedBufferTest()
+    {
+        auto m = sbepp::make_view<test_schema::messages::msg27>(
+            buf.data(), buf.size());
+        sbepp::fill_message_header(m);
+        auto g = m.group();
+        sbepp::fill_group_header(g, 2);
+        g[0].number(1);
+        g[1].number(2);
+        auto d = m.data();
+        d.resize(5);
+        for(std::size_t i = 0; i != d.size(); i++)
+        {
+            d[i] = static_cast<char>('a' + i);
+        }
+        message_size = sbepp::size_bytes(m);
+        message.assign(buf.data(), buf.data() + message_size);
+    }
+
+    // splits the message at `offset`, the second segment has some extra bytes
+    buffer_t split(const std::size_t offset)
+    {
+        second.assign(message.begin() + offset, message.end());
+        second.resize(second.size() + 8);
+        return {message.data(), offset, second.data(), second.size()};
+    }
+
+    std::array<byte_type, 256> buf{};
+    std::size_t message_size{};
+    std::vector<byte_type> message;
+    std::vector<byte_type> second;
+    std::array<byte_type, 256> scratch{};
+};
+
+TEST_F(SegmentedBufferTest, ReturnsInPlaceViewIfMessageIsInFirstSegment)
+{
+    const buffer_t buffer{buf.data(), buf.size(), nullptr, 0};
+
+    const auto res = sbepp::make_segmented_view<test_schema::messages::msg27>(
+        buffer, scratch.data(), scratch.size());
+
+    ASSERT_TRUE(res);
+    ASSERT_EQ(sbepp::addressof(*res), buf.data());
+    ASSERT_EQ(sbepp::size_bytes(*res), message_size);
+    ASSERT_EQ(res->data().size(), 5u);
+}
+
+TEST_F(SegmentedBufferTest, ReturnsInPlaceViewIfFirstSegmentIsEmpty)
+{
+    const buffer_t buffer{nullptr, 0, buf.data(), buf.size()};
+
+    const auto res = sbepp::make_segmented_view<test_schema::messages::msg27>(
+        buffer, scratch.data(), scratch.size());
+
+    ASSERT_TRUE(res);
+    ASSERT_EQ(sbepp::addressof(*res), buf.data());
+}
+
+TEST_F(SegmentedBufferTest, ReturnsInPlaceViewIfMessageEndsRightAtSegmentEnd)
+{
+    const buffer_t buffer{message.data(), message.size(), nullptr, 0};
+
+    const auto res = sbepp::make_segmented_view<test_schema::messages::msg27>(
+        buffer, scratch.data(), scratch.size());
+
+    ASSERT_TRUE(res);
+    ASSERT_EQ(sbepp::addressof(*res), message.data());
+    ASSERT_EQ(sbepp::size_bytes(*res), message_size);
+}
+
+TEST_F(SegmentedBufferTest, CopiesMessageWhichCrossesSegmentBoundary)
+{
+    for(std::size_t offset = 1; offset != message_size; offset++)
+    {
+        scratch.fill(0);
+        const auto res =
+            sbepp::make_segmented_view<test_schema::messages::msg27>(
+                split(offset), scratch.data(), scratch.size());
+
+        ASSERT_TRUE(res) << offset;
+        ASSERT_EQ(sbepp::addressof(*res), scratch.data());
+        ASSERT_EQ(sbepp::size_bytes(*res), message_size);
+        ASSERT_EQ(
+            std::vector<byte_type>(
+                scratch.begin(), scratch.begin() + message_size),
+            message);
+        ASSERT_EQ(res->group()[1].number(), 2);
+        ASSERT_EQ(res->data()[4], 'e');
+    }
+}
+
+TEST_F(SegmentedBufferTest, CopiesMessageIntoExactSizeScratch)
+{
+    for(std::size_t offset = 1; offset != message_size; offset++)
+    {
+        // no extra bytes after the message in both segments
+        const buffer_t buffer{
+            message.data(),
+            offset,
+            message.data() + offset,
+            message_size - offset};
+        std::vector<byte_type> exact_scratch(message_size);
+
+        const auto res =
+            sbepp::make_segmented_view<test_schema::messages::msg27>(
+                buffer, exact_scratch.data(), exact_scratch.size());
+
+        ASSERT_TRUE(res) << offset;
+        ASSERT_EQ(sbepp::addressof(*res), exact_scratch.data());
+        ASSERT_EQ(sbepp::size_bytes(*res), message_size);
+        ASSERT_EQ(exact_scratch, message);
+    }
+}
+
+TEST_F(SegmentedBufferTest, FailsIfMessageDoesNotFitIntoScratch)
+{
+    const auto res = sbepp::make_segmented_view<test_schema::messages::msg27>(
+        split(10), scratch.data(), message_size - 1);
+
+    ASSERT_FALSE(res);
+    ASSERT_EQ(res.error(), sbepp::access_error::out_of_bounds);
+}
+
+TEST_F(SegmentedBufferTest, FailsIfMessageIsIncomplete)
+{
+    const buffer_t buffer{message.data(), 10, message.data() + 10, 5};
+
+    const auto res = sbepp::make_segmented_view<test_schema::messages::msg27>(
+        buffer, scratch.data(), scratch.size());
+
+    ASSERT_FALSE(res);
+}
+
+TEST_F(SegmentedBufferTest, SchemaVersionDetectsMessageType)
+{
+    const auto in_place = sbepp::make_segmented_message<schema_tag>(
+        buffer_t{buf.data(), buf.size(), nullptr, 0},
+        scratch.data(),
+        scratch.size());
+
+    ASSERT_TRUE(in_place);
+    ASSERT_EQ(in_place->data(), buf.data());
+    ASSERT_EQ(in_place->size(), message_size);
+    ASSERT_EQ(in_place->template_id(), 27u);
+
+    const auto copied = sbepp::make_segmented_message<schema_tag>(
+        split(3), scratch.data(), scratch.size());
+
+    ASSERT_TRUE(copied);
+    ASSERT_EQ(copied->data(), scratch.data());
+    ASSERT_EQ(copied->size(), message_size);
+    ASSERT_EQ(copied->template_id(), 27u);
+}
+} // namespace
@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: MIT
 // Copyright (c) 2023, Oleksandr Koval
 
+#include <test_schema/messages/msg2.hpp>
 #include <test_schema/messages/msg27.hpp>
 
 #include <sbepp/test/utils.hpp>
@@ -13,6 +14,7 @@ namespace
 {
 using byte_type = std::uint8_t;
 using message_t = test_schema::messages::msg27<byte_type>;
+using message_tag = test_schema::schema::messages::msg27;
 
 class SizeBytesCheckedTest : public ::testing::Test
 {
@@ -75,6 +77,19 @@ TEST_F(SizeBytesCheckedTest, FailsIfNoSpaceForGroupHeader)
     ASSERT_FALSE(sbepp::size_bytes_checked(g, not_enough_size).valid);
 }
 
+TEST_F(SizeBytesCheckedTest, DoesNotAccessGroupHeaderBeforeValidation)
+{
+    // views end inside the group header, accessing it would trigger size check
+    auto g = msg.group();
+    const auto group_offset =
+        static_cast<std::size_t>(sbepp::addressof(g) - buf.data());
+    const message_t m{buf.data(), group_offset + 1};
+    const decltype(g) short_g{sbepp::addressof(g), 1};
+
+    ASSERT_FALSE(sbepp::size_bytes_checked(m, group_offset + 1).valid);
+    ASSERT_FALSE(sbepp::size_bytes_checked(short_g, 1).valid);
+}
+
 TEST_F(SizeBytesCheckedTest, FailsIfNoSpaceForMessageBlockLength)
 {
     const auto not_enough_size = *sbepp::get_header(msg).blockLength() - 1;
@@ -98,6 +113,52 @@ TEST_F(SizeBytesCheckedTest, FailsIfNoSpaceForData)
     ASSERT_FALSE(sbepp::size_bytes_checked(msg, not_enough_size).valid);
 }
 
+TEST_F(SizeBytesCheckedTest, IndexesMessageInTheSamePass)
+{
+    sbepp::indexed_view<message_t> iv;
+    const auto res = sbepp::size_bytes_checked(msg, buf.size(), iv);
+
+    ASSERT_TRUE(res.valid);
+    ASSERT_EQ(res.size, sbepp::size_bytes(msg));
+    ASSERT_EQ(
+        iv.cached_offsets(), sbepp::make_indexed_view(msg).cached_offsets());
+    ASSERT_EQ(
+        sbepp::addressof(iv.get<message_tag::data>()),
+        sbepp::addressof(msg.data()));
+    STATIC_ASSERT(noexcept(sbepp::size_bytes_checked(msg, buf.size(), iv)));
+}
+
+TEST_F(SizeBytesCheckedTest, IndexesOnlyTopLevelMembers)
+{
+    test_schema::messages::msg2<byte_type> m{buf.data(), buf.size()};
+    sbepp::fill_message_header(m);
+    auto g = m.group();
+    sbepp::fill_group_header(g, 2);
+    for(const auto entry : g)
+    {
+        sbepp::fill_group_header(entry.group(), 1);
+        entry.data().resize(3);
+    }
+    m.data().resize(4);
+
+    sbepp::indexed_view<decltype(m)> iv;
+    const auto res = sbepp::size_bytes_checked(m, buf.size(), iv);
+
+    ASSERT_TRUE(res.valid);
+    ASSERT_EQ(
+        iv.cached_offsets(), sbepp::make_indexed_view(m).cached_offsets());
+}
+
+TEST_F(SizeBytesCheckedTest, DoesNotChangeIndexIfValidationFails)
+{
+    sbepp::indexed_view<message_t> iv;
+    const auto res =
+        sbepp::size_bytes_checked(msg, sbepp::size_bytes(msg) - 1, iv);
+
+    ASSERT_FALSE(res.valid);
+    ASSERT_EQ(sbepp::addressof(iv.message()), nullptr);
+}
+
 #if SBEPP_HAS_CONSTEXPR_ACCESSORS
 constexpr auto constexpr_test()
 {
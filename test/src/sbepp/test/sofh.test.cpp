@@ -0,0 +1,194 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Oleksandr Koval
+
+#include <test_schema/test_schema.hpp>
+
+#include <sbepp/test/utils.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace
+{
+using byte_type = std::uint8_t;
+using reassembler_t = sbepp::sofh_reassembler<byte_type>;
+
+IS_SAME_TYPE(reassembler_t::frame_type, sbepp::sofh_frame<const byte_type>);
+STATIC_ASSERT(sbepp::sofh_size() == 6);
+STATIC_ASSERT(
+    sbepp::sofh_schema_encoding<test_schema::schema>()
+    == sbepp::sofh_encoding::sbe_little_endian);
+
+TEST(SofhTest, EncodesBigEndianHeader)
+{
+    std::array<byte_type, 16> buf{};
+
+    const auto end = sbepp::encode_sofh(
+        buf.data(), 10, sbepp::sofh_encoding::sbe_little_endian);
+
+    ASSERT_EQ(end, buf.data() + 16);
+    ASSERT_EQ(buf[0], 0);
+    ASSERT_EQ(buf[1], 0);
+    ASSERT_EQ(buf[2], 0);
+    ASSERT_EQ(buf[3], 16);
+    ASSERT_EQ(buf[4], 0xEB);
+    ASSERT_EQ(buf[5], 0x50);
+}
+
+TEST(SofhTest, DecodesEncodedHeader)
+{
+    std::array<byte_type, 6> buf{};
+    sbepp::encode_sofh(buf.data(), 300, sbepp::sofh_encoding::sbe_big_endian);
+
+    const auto header = sbepp::decode_sofh(buf.data());
+
+    ASSERT_EQ(header.message_length, 306u);
+    ASSERT_EQ(header.encoding, sbepp::sofh_encoding::sbe_big_endian);
+}
+
+class SofhReassemblerTest : public ::testing::Test
+{
+public:
+    SofhReassemblerTest()
+    {
+        // three frames with 4, 10 and 1 byte messages
+        for(const std::size_t size : {4, 10, 1})
+        {
+            std::vector<byte_type> frame(sbepp::sofh_size() + size);
+            sbepp::encode_sofh(
+                frame.data(), size, sbepp::sofh_encoding::sbe_little_endian);
+            for(std::size_t i = 0; i != size; i++)
+            {
+                frame[sbepp::sofh_size() + i] =
+                    static_cast<byte_type>(frames.size() * 10 + i);
+            }
+            frames.push_back(frame);
+            stream.insert(stream.end(), frame.begin(), frame.end());
+        }
+    }
+
+    void on_frame(const reassembler_t::frame_type frame)
+    {
+        messages.emplace_back(frame.data(), frame.data() + frame.size());
+        pointers.push_back(frame.data());
+    }
+
+    std::vector<std::vector<byte_type>> frames;
+    std::vector<byte_type> stream;
+    std::array<byte_type, 32> storage{};
+    reassembler_t reassembler{storage.data(), storage.size()};
+    std::vector<std::vector<byte_type>> messages;
+    std::vector<const byte_type*> pointers;
+};
+
+TEST_F(SofhReassemblerTest, PassesContiguousFramesWithoutCopying)
+{
+    const auto ok = reassembler.feed(
+        stream.data(),
+        stream.size(),
+        [this](const reassembler_t::frame_type frame)
+        {
+            on_frame(frame);
+        });
+
+    ASSERT_TRUE(ok);
+    ASSERT_EQ(messages.size(), 3u);
+    ASSERT_EQ(pointers[0], stream.data() + sbepp::sofh_size());
+    ASSERT_EQ(pointers[1], stream.data() + frames[0].size() + 6);
+    ASSERT_EQ(messages[1].size(), 10u);
+    ASSERT_EQ(messages[1][3], 13);
+    ASSERT_EQ(reassembler.buffered_size(), 0u);
+}
+
+TEST_F(SofhReassemblerTest, ReassemblesSplitFrames)
+{
+    const auto cb = [this](const reassembler_t::frame_type frame)
+    {
+        on_frame(frame);
+    };
+    // split the second frame
+    const auto split = frames[0].size() + 9;
+
+    ASSERT_TRUE(reassembler.feed(stream.data(), split, cb));
+    ASSERT_EQ(messages.size(), 1u);
+    ASSERT_EQ(reassembler.buffered_size(), 9u);
+
+    ASSERT_TRUE(reassembler.feed(
+        stream.data() + split, stream.size() - split, cb));
+    ASSERT_EQ(messages.size(), 3u);
+    ASSERT_EQ(pointers[1], storage.data() + sbepp::sofh_size());
+    ASSERT_EQ(
+        messages[1],
+        std::vector<byte_type>(frames[1].begin() + 6, frames[1].end()));
+    // the last one is passed without copying
+    ASSERT_EQ(pointers[2], stream.data() + stream.size() - 1);
+    ASSERT_EQ(reassembler.buffered_size(), 0u);
+}
+
+TEST_F(SofhReassemblerTest, HandlesByteByByteInput)
+{
+    for(const auto b : stream)
+    {
+        ASSERT_TRUE(reassembler.feed(
+            &b,
+            1,
+            [this](const reassembler_t::frame_type frame)
+            {
+                on_frame(frame);
+            }));
+    }
+
+    ASSERT_EQ(messages.size(), 3u);
+    for(std::size_t i = 0; i != frames.size(); i++)
+    {
+        ASSERT_EQ(
+            messages[i],
+            std::vector<byte_type>(frames[i].begin() + 6, frames[i].end()));
+    }
+}
+
+TEST_F(SofhReassemblerTest, FailsIfSplitFrameDoesNotFitIntoBuffer)
+{
+    reassembler_t small{storage.data(), 12};
+    const auto cb = [this](const reassembler_t::frame_type frame)
+    {
+        on_frame(frame);
+    };
+
+    // the first frame fits, the second one doesn't
+    ASSERT_TRUE(small.feed(stream.data(), 3, cb));
+    ASSERT_TRUE(small.feed(stream.data() + 3, frames[0].size() - 3, cb));
+    ASSERT_FALSE(small.feed(
+        stream.data() + frames[0].size(), sbepp::sofh_size(), cb));
+    ASSERT_EQ(messages.size(), 1u);
+
+    small.reset();
+
+    ASSERT_EQ(small.buffered_size(), 0u);
+    // contiguous frames don't need buffer
+    ASSERT_TRUE(small.feed(
+        stream.data() + frames[0].size(),
+        stream.size() - frames[0].size(),
+        cb));
+    ASSERT_EQ(messages.size(), 3u);
+}
+
+TEST_F(SofhReassemblerTest, FailsOnInvalidLength)
+{
+    sbepp::encode_sofh(
+        stream.data(), 0, sbepp::sofh_encoding::sbe_little_endian);
+    stream[3] = 5;
+
+    ASSERT_FALSE(reassembler.feed(
+        stream.data(),
+        stream.size(),
+        [this](const reassembler_t::frame_type frame)
+        {
+            on_frame(frame);
+        }));
+    ASSERT_TRUE(messages.empty());
+}
+} // namespace
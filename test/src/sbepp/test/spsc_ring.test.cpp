@@ -0,0 +1,157 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Oleksandr Koval
+
+#include <test_schema/test_schema.hpp>
+
+#include <sbepp/ring.hpp>
+#include <sbepp/test/utils.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using msg28_tag = test_schema::schema::messages::msg28;
+
+std::size_t encode(const sbepp::ring_claim& claim, const std::uint32_t value)
+{
+    auto m = sbepp::make_view<test_schema::messages::msg28>(claim);
+    sbepp::fill_message_header(m);
+    m.required(value);
+    auto g = m.group();
+    sbepp::fill_group_header(g, 0);
+    m.varData().clear();
+    m.varStr().clear();
+    return sbepp::size_bytes(m);
+}
+
+std::uint32_t decode(const std::uint8_t* data, const std::size_t size)
+{
+    const auto m =
+        sbepp::make_const_view<test_schema::messages::msg28>(data, size);
+    EXPECT_EQ(sbepp::size_bytes(m), size);
+    return *m.required();
+}
+
+TEST(SpscRingTest, ConsumerReadsCommittedMessagesInPlace)
+{
+    sbepp::spsc_ring ring{1024};
+    auto claim = ring.claim();
+
+    ASSERT_FALSE(claim.empty());
+    ASSERT_EQ(claim.size(), ring.max_size());
+
+    const auto size = encode(claim, 1);
+    ring.commit(size);
+    std::vector<std::uint32_t> values;
+    const auto count = ring.poll(
+        [&values, &claim, size](const std::uint8_t* data, std::size_t n)
+        {
+            ASSERT_EQ(data, claim.data());
+            ASSERT_EQ(n, size);
+            values.push_back(decode(data, n));
+        });
+
+    ASSERT_EQ(count, 1u);
+    ASSERT_EQ(values, std::vector<std::uint32_t>{1});
+    ASSERT_EQ(ring.poll([](const std::uint8_t*, std::size_t) {}), 0u);
+}
+
+TEST(SpscRingTest, ClaimFailsWhenRingIsFull)
+{
+    sbepp::spsc_ring ring{1024};
+    const auto size = sbepp::message_traits<msg28_tag>::size_bytes(0, 0);
+    std::size_t committed{};
+    while(true)
+    {
+        const auto claim = ring.claim(size);
+        if(claim.empty())
+        {
+            break;
+        }
+        ring.commit(encode(claim, static_cast<std::uint32_t>(committed)));
+        committed++;
+    }
+
+    ASSERT_GT(committed, 0u);
+
+    std::uint32_t expected{};
+    const auto count = ring.poll(
+        [&expected](const std::uint8_t* data, std::size_t n)
+        {
+            ASSERT_EQ(decode(data, n), expected);
+            expected++;
+        },
+        1);
+
+    ASSERT_EQ(count, 1u);
+    ASSERT_FALSE(ring.claim(size).empty());
+}
+
+TEST(SpscRingTest, WrapsAroundUsingPadding)
+{
+    sbepp::spsc_ring ring{1024};
+    const auto size = sbepp::message_traits<msg28_tag>::size_bytes(0, 0);
+    std::uint32_t expected{};
+    for(std::uint32_t i = 0; i != 100; i++)
+    {
+        const auto claim = ring.claim(size);
+        ASSERT_FALSE(claim.empty());
+        ring.commit(encode(claim, i));
+        ring.poll(
+            [&expected](const std::uint8_t* data, std::size_t n)
+            {
+                ASSERT_EQ(decode(data, n), expected);
+                expected++;
+            });
+    }
+
+    ASSERT_EQ(expected, 100u);
+}
+
+TEST(SpscRingTest, TransfersMessagesBetweenThreads)
+{
+    constexpr std::uint32_t message_count = 10000;
+    sbepp::spsc_ring ring{4096};
+    const auto size = sbepp::message_traits<msg28_tag>::size_bytes(0, 0);
+
+    std::thread producer{[&ring, size]
+                         {
+                             for(std::uint32_t i = 0; i != message_count;)
+                             {
+                                 const auto claim = ring.claim(size);
+                                 if(!claim.empty())
+                                 {
+                                     ring.commit(encode(claim, i));
+                                     i++;
+                                 }
+                                 else
+                                 {
+                                     std::this_thread::yield();
+                                 }
+                             }
+                         }};
+
+    std::uint32_t expected{};
+    bool in_order{true};
+    while(expected != message_count)
+    {
+        const auto count = ring.poll(
+            [&expected, &in_order](const std::uint8_t* data, std::size_t n)
+            {
+                in_order = in_order && (decode(data, n) == expected);
+                expected++;
+            });
+        if(!count)
+        {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+
+    ASSERT_TRUE(in_order);
+}
+} // namespace
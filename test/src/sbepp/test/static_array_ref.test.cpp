@@ -1,17 +1,22 @@
 // SPDX-License-Identifier: MIT
 // Copyright (c) 2023, Oleksandr Koval
 
+#include <big_endian_schema/big_endian_schema.hpp>
+#include <test_schema/types/arr8.hpp>
+
 #include <sbepp/sbepp.hpp>
 #include <sbepp/test/utils.hpp>
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <iterator>
 #include <type_traits>
 #include <vector>
 #include <array>
 #include <cstring>
 #include <initializer_list>
+#include <utility>
 
 namespace
 {
@@ -19,9 +24,13 @@ struct test_tag
 {
 };
 
-template<typename Byte, typename Value, std::size_t N>
+template<
+    typename Byte,
+    typename Value,
+    std::size_t N,
+    sbepp::endian E = sbepp::endian::native>
 using static_array_ref =
-    sbepp::detail::static_array_ref<Byte, Value, N, test_tag>;
+    sbepp::detail::static_array_ref<Byte, Value, N, test_tag, E>;
 
 constexpr auto g_array_size = 128;
 using value_type = char;
@@ -308,6 +317,59 @@ TEST_F(StaticArrayRefTest, StrlenRReturnsDistanceToLastNonNull)
     STATIC_ASSERT(noexcept(a.strlen_r()));
 }
 
+TEST_F(StaticArrayRefTest, StrlenRFindsLastNonNullAtAnyPosition)
+{
+    for(std::size_t i = 0; i != a.size(); i++)
+    {
+        a.fill('\0');
+        a[i] = 'x';
+
+        ASSERT_EQ(a.strlen_r(), i + 1);
+    }
+}
+
+TEST(StaticArrayRefStrlenTest, StrlenRWorksWithShortArrays)
+{
+    std::array<byte_type, 3> buf{'a', 'b', '\0'};
+    const static_array_ref<byte_type, value_type, 3> a{buf.data(), buf.size()};
+
+    ASSERT_EQ(a.strlen_r(), 2u);
+}
+
+#if SBEPP_HAS_STRING_VIEW
+TEST_F(StaticArrayRefTest, ToStringViewReturnsStringUpToFirstNull)
+{
+    a.assign_string("abc");
+
+    ASSERT_EQ(a.to_string_view(), "abc");
+    ASSERT_EQ(a.to_string_view().data(), a.data());
+
+    a.fill('x');
+
+    ASSERT_EQ(a.to_string_view().size(), a.size());
+    STATIC_ASSERT(noexcept(a.to_string_view()));
+}
+
+template<typename T, typename = void>
+struct has_to_string_view : std::false_type
+{
+};
+
+template<typename T>
+struct has_to_string_view<
+    T,
+    decltype(void(std::declval<T>().to_string_view()))> : std::true_type
+{
+};
+
+TEST(StaticArrayRefStrlenTest, ToStringViewIsAvailableOnlyForCharArrays)
+{
+    STATIC_ASSERT(has_to_string_view<const_array_t>::value);
+    STATIC_ASSERT(
+        !has_to_string_view<static_array_ref<byte_type, byte_type, 1>>::value);
+}
+#endif
+
 TEST_F(StaticArrayRefTest, AssignString1AssignsStringWithNoPadding)
 {
     const auto str = "abc";
@@ -656,6 +718,119 @@ TEST_F(StaticArrayRefDeathTest, Assign3TerminatesIfListIsTooLong)
     ASSERT_DEATH({ a.assign(list); }, ".*");
 }
 
+TEST(StaticArrayRefBulkTest, CopyToConvertsFromSchemaByteOrder)
+{
+    using array_t =
+        static_array_ref<byte_type, std::uint32_t, 3, sbepp::endian::big>;
+    std::array<byte_type, 12> buf{
+        0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x02, 0x03, 0x04};
+    const array_t a{buf.data(), buf.size()};
+    std::array<std::uint32_t, 3> values{};
+
+    const auto res = a.copy_to(values.data());
+
+    ASSERT_EQ(res, values.data() + values.size());
+    ASSERT_EQ(values[0], 1u);
+    ASSERT_EQ(values[1], 0x100u);
+    ASSERT_EQ(values[2], 0x01020304u);
+
+    using native_array_t = static_array_ref<byte_type, std::uint32_t, 3>;
+    native_array_t{buf.data(), buf.size()}.copy_to(values.data());
+
+    ASSERT_EQ(std::memcmp(values.data(), buf.data(), buf.size()), 0);
+    STATIC_ASSERT(noexcept(a.copy_to(values.data())));
+}
+
+TEST(StaticArrayRefBulkTest, AssignFromConvertsToSchemaByteOrder)
+{
+    using array_t =
+        static_array_ref<byte_type, std::int64_t, 2, sbepp::endian::big>;
+    std::array<byte_type, 16> buf{};
+    const array_t a{buf.data(), buf.size()};
+    const std::array<std::int64_t, 2> values{-2, 0x0102030405060708};
+
+    const auto res = a.assign_from(values.data(), values.size());
+
+    const std::array<byte_type, 16> expected{
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
+        0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08};
+    ASSERT_EQ(res, a.end());
+    ASSERT_EQ(buf, expected);
+
+    std::array<std::int64_t, 2> decoded{};
+    a.copy_to(decoded.data());
+
+    ASSERT_EQ(decoded, values);
+
+    using native_array_t = static_array_ref<byte_type, std::int64_t, 2>;
+    const native_array_t native{buf.data(), buf.size()};
+    native.assign_from(values.data(), 1);
+
+    ASSERT_EQ(native[0], -2);
+    // the rest of elements is not touched
+    ASSERT_TRUE(std::equal(buf.begin() + 8, buf.end(), expected.begin() + 8));
+}
+
+template<typename T>
+struct array_byte_order;
+
+template<
+    typename Byte,
+    typename Value,
+    std::size_t N,
+    typename Tag,
+    sbepp::endian E>
+struct array_byte_order<sbepp::detail::static_array_ref<Byte, Value, N, Tag, E>>
+    : std::integral_constant<sbepp::endian, E>
+{
+};
+
+// byte order defaults to native for compatibility with 4-parameter form
+STATIC_ASSERT_V(std::is_same<
+                sbepp::detail::static_array_ref<char, char, 1, test_tag>,
+                sbepp::detail::static_array_ref<
+                    char,
+                    char,
+                    1,
+                    test_tag,
+                    sbepp::endian::native>>);
+
+// generated arrays get schema byte order from `sbeppc`
+STATIC_ASSERT(
+    array_byte_order<test_schema::types::arr8<byte_type>>::value
+    == sbepp::endian::little);
+STATIC_ASSERT(
+    array_byte_order<decltype(std::declval<
+                              big_endian_schema::types::varDataEncoding<
+                                  byte_type>>()
+                                  .varData())>::value
+    == sbepp::endian::big);
+
+struct test_assign_from
+{
+    template<typename T>
+    auto operator()(T obj)
+        -> decltype(obj.assign_from(
+            static_cast<const value_type*>(nullptr), 0))
+    {
+    }
+};
+
+TEST_F(StaticArrayRefTest, AssignFromNotAvailableForConstByteTypes)
+{
+    STATIC_ASSERT(
+        !sbepp::test::utils::is_invocable<test_assign_from, const_array_t>::
+            value);
+}
+
+TEST_F(StaticArrayRefDeathTest, AssignFromTerminatesIfCountIsTooBig)
+{
+    std::vector<char> values;
+    values.resize(a.size() + 1);
+
+    ASSERT_DEATH({ a.assign_from(values.data(), values.size()); }, ".*");
+}
+
 #if SBEPP_HAS_CONSTEXPR_ACCESSORS
 constexpr auto constexpr_test()
 {
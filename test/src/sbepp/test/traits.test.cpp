@@ -5,6 +5,8 @@
 #include <traits_test_schema/types/groupSizeEncoding.hpp>
 #include <traits_test_schema/types/customGroupSizeEncoding.hpp>
 #include <traits_test_schema/types/varDataEncoding.hpp>
+#include <traits_test_schema/types/boundedGroupSizeEncoding.hpp>
+#include <traits_test_schema/types/boundedDataEncoding.hpp>
 #include <traits_test_schema/types/enum_1.hpp>
 #include <traits_test_schema/types/enum_2.hpp>
 #include <traits_test_schema/types/composite_1.hpp>
@@ -40,6 +42,8 @@
 #include <traits_test_schema/messages/msg_15.hpp>
 #include <traits_test_schema/messages/msg_16.hpp>
 #include <traits_test_schema/messages/msg_17.hpp>
+#include <traits_test_schema/messages/msg_18.hpp>
+#include <traits_test_schema/messages/msg_19.hpp>
 
 #include <traits_test_schema2/schema/schema.hpp>
 
@@ -174,6 +178,8 @@ TEST(SchemaTraitsTest, ProvidesTypeAndMessageTags)
                 types::groupSizeEncoding,
                 types::customGroupSizeEncoding,
                 types::varDataEncoding,
+                types::boundedGroupSizeEncoding,
+                types::boundedDataEncoding,
                 types::enum_1,
                 types::enum_2,
                 types::composite_1,
@@ -213,7 +219,9 @@ TEST(SchemaTraitsTest, ProvidesTypeAndMessageTags)
                 messages::msg_14,
                 messages::msg_15,
                 messages::msg_16,
-                messages::msg_17>>);
+                messages::msg_17,
+                messages::msg_18,
+                messages::msg_19>>);
 
     STATIC_ASSERT_V(
         std::is_same<
@@ -965,6 +973,83 @@ TEST(GroupTraitsTest, NestedGroupSizeBytesHasSizeParameterForEachGroup)
         traits::size_bytes(root_group_size, child_group_size, total_data_size));
 }
 
+TEST(DataTraitsTest, MaxSizeBytesIsBasedOnLengthMaxValue)
+{
+    using tag = traits_test_schema::schema::messages::msg_18::data_1;
+    using traits = sbepp::data_traits<tag>;
+
+    STATIC_ASSERT(traits::max_size_bytes() == traits::size_bytes(100));
+    IS_NOEXCEPT(traits::max_size_bytes());
+}
+
+TEST(DataTraitsTest, MaxSizeBytesIsUnboundedWithoutLengthMaxValue)
+{
+    using msg_tag = traits_test_schema::schema::messages::msg_5;
+    using group_tag =
+        traits_test_schema::schema::messages::msg_19::group_1::group_2::group_3;
+
+    STATIC_ASSERT(
+        sbepp::data_traits<msg_tag::data_2>::max_size_bytes()
+        == sbepp::unbounded_size_bytes);
+    STATIC_ASSERT(
+        sbepp::data_traits<group_tag::data>::max_size_bytes()
+        == sbepp::unbounded_size_bytes);
+    // propagates to enclosing levels
+    STATIC_ASSERT(
+        sbepp::message_traits<msg_tag>::max_size_bytes()
+        == sbepp::unbounded_size_bytes);
+    STATIC_ASSERT(
+        sbepp::group_traits<group_tag>::max_size_bytes()
+        == sbepp::unbounded_size_bytes);
+}
+
+TEST(GroupTraitsTest, MaxSizeBytesIsBasedOnNumInGroupMaxValue)
+{
+    using tag = traits_test_schema::schema::messages::msg_18::group_1;
+    using traits = sbepp::group_traits<tag>;
+    constexpr auto max_nested_size =
+        sbepp::group_traits<tag::group_2>::size_bytes(10);
+    constexpr auto valid_size =
+        sbepp::composite_traits<traits::dimension_type_tag>::size_bytes()
+        + 10
+              * (traits::block_length() + max_nested_size
+                 + sbepp::data_traits<tag::data>::size_bytes(100));
+
+    STATIC_ASSERT(
+        sbepp::group_traits<tag::group_2>::max_size_bytes()
+        == max_nested_size);
+    STATIC_ASSERT(traits::max_size_bytes() == valid_size);
+    IS_NOEXCEPT(traits::max_size_bytes());
+}
+
+TEST(MessageTraitsTest, MaxSizeBytesIncludesAllMembers)
+{
+    using tag = traits_test_schema::schema::messages::msg_18;
+    using traits = sbepp::message_traits<tag>;
+    constexpr auto valid_size =
+        sbepp::composite_traits<sbepp::schema_traits<
+            traits::schema_tag>::header_type_tag>::size_bytes()
+        + traits::block_length()
+        + sbepp::group_traits<tag::group_1>::max_size_bytes()
+        + sbepp::data_traits<tag::data_1>::size_bytes(100)
+        + sbepp::data_traits<tag::data_2>::size_bytes(100);
+
+    STATIC_ASSERT(traits::max_size_bytes() == valid_size);
+    IS_NOEXCEPT(traits::max_size_bytes());
+}
+
+TEST(MessageTraitsTest, MaxSizeBytesSaturatesOnOverflow)
+{
+    using tag = traits_test_schema::schema::messages::msg_19;
+
+    STATIC_ASSERT(
+        sbepp::message_traits<tag>::max_size_bytes()
+        == sbepp::unbounded_size_bytes);
+    STATIC_ASSERT(
+        sbepp::group_traits<tag::group_1>::max_size_bytes()
+        == sbepp::unbounded_size_bytes);
+}
+
 TEST(MessageTraitsTest, EmptyMessageSizeIsHeaderSize)
 {
     using tag = traits_test_schema::schema::messages::msg_7;
@@ -79,6 +79,56 @@ TEST(MakeViewTest, ConstMakeViewAddsConstToByteType)
     ASSERT_EQ(v.get_size(), arr.size());
 }
 
+TEST(MakeUncheckedViewTest, CreatesViewWithoutEndPointer)
+{
+    std::array<byte_type, 512> buf{};
+
+    auto m = sbepp::make_unchecked_view<test_schema::messages::msg2>(buf.data());
+
+    IS_SAME_TYPE(decltype(m), test_schema::messages::msg2<byte_type>);
+    STATIC_ASSERT(
+        noexcept(sbepp::make_unchecked_view<test_schema::messages::msg2>(
+            buf.data())));
+    ASSERT_EQ(sbepp::addressof(m), buf.data());
+    ASSERT_EQ(m(sbepp::detail::end_ptr_tag{}), nullptr);
+}
+
+TEST(MakeUncheckedViewTest, ConstVersionAddsConstToByteType)
+{
+    std::array<byte_type, 512> buf{};
+
+    auto m = sbepp::make_unchecked_const_view<test_schema::messages::msg2>(
+        buf.data());
+
+    IS_SAME_TYPE(decltype(m), test_schema::messages::msg2<const byte_type>);
+    ASSERT_EQ(sbepp::addressof(m), buf.data());
+    ASSERT_EQ(m(sbepp::detail::end_ptr_tag{}), nullptr);
+}
+
+TEST(MakeUncheckedViewTest, NestedViewsAreUnchecked)
+{
+    std::array<byte_type, 512> buf{};
+    auto m = sbepp::make_unchecked_view<test_schema::messages::msg2>(buf.data());
+    sbepp::fill_message_header(m);
+    sbepp::fill_group_header(m.group(), 2);
+    for(const auto entry : m.group())
+    {
+        entry.number(1);
+        sbepp::fill_group_header(entry.group(), 1);
+        entry.data().resize(2);
+
+        ASSERT_EQ(entry(sbepp::detail::end_ptr_tag{}), nullptr);
+        ASSERT_EQ(entry.group()(sbepp::detail::end_ptr_tag{}), nullptr);
+    }
+    m.data().resize(3);
+
+    ASSERT_EQ(m.data()(sbepp::detail::end_ptr_tag{}), nullptr);
+    ASSERT_EQ(
+        sbepp::size_bytes(m),
+        sbepp::size_bytes(sbepp::make_view<test_schema::messages::msg2>(
+            buf.data(), buf.size())));
+}
+
 TEST(ByteTypeTest, ByteTypeProvidesViewByteType)
 {
     using view_type = test_schema::messages::msg2<byte_type>;
@@ -92,6 +142,8 @@ constexpr auto constexpr_test()
     std::array<byte_type, 512> buf{};
     sbepp::make_view<view>(buf.data(), buf.size());
     sbepp::make_const_view<view>(buf.data(), buf.size());
+    sbepp::make_unchecked_view<test_schema::messages::msg2>(buf.data());
+    sbepp::make_unchecked_const_view<test_schema::messages::msg2>(buf.data());
 
     return buf;
 }